@@ -26,6 +26,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +40,32 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how the infer requests are distributed between the devices
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+
+/**
+ * @brief Default policy: a request goes to the first device in the priority order which has an idle worker request
+ */
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+
+/**
+ * @brief A request goes to the device with the earliest expected completion time, estimated from the recent
+ * service time of the device and the number of requests already running or waiting on it
+ */
+DECLARE_MULTI_CONFIG_VALUE(EARLIEST_COMPLETION);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a std::map<std::string, std::map<std::string, double>> of per-device scheduling statistics
+ * of the MULTI executable network: LATENCY_EWMA_MS, LATENCY_AVG_MS, THROUGHPUT_FPS, COMPLETED_REQUESTS,
+ * IN_FLIGHT_REQUESTS and QUEUED_REQUESTS values for each device name
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_STATISTICS, std::map<std::string, std::map<std::string, double>>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
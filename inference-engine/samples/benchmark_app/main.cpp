@@ -676,6 +676,11 @@ int main(int argc, char* argv[]) {
             }
             if (statistics) {
                 statistics->dumpPerformanceCounters(perfCounts);
+                try {
+                    statistics->dumpExecGraphStatistics(exeNetwork.GetExecGraphInfo());
+                } catch (const std::exception& ex) {
+                    slog::warn << "Can't get executable graph statistics: " << ex.what() << slog::endl;
+                }
             }
         }
 
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <map>
+#include <ngraph/variant.hpp>
 #include <string>
 #include <utility>
 #include <vector>
@@ -141,3 +142,59 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpExecGraphStatistics(const InferenceEngine::CNNNetwork& execGraph) {
+    if (_config.report_type != detailedCntReport)
+        return;
+    auto function = execGraph.getFunction();
+    if (!function)
+        return;
+
+    auto getRtInfo = [](const std::shared_ptr<ngraph::Node>& node, const std::string& key) -> std::string {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(key);
+        if (it == rtInfo.end())
+            return "";
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        return value ? value->get() : "";
+    };
+
+    // plugins that don't collect the latency distribution don't provide the percentile keys
+    const auto& ops = function->get_ordered_ops();
+    bool hasStatistics = std::any_of(ops.begin(), ops.end(), [&](const std::shared_ptr<ngraph::Node>& node) {
+        return !getRtInfo(node, "execTimeP50Mcs").empty();
+    });
+    if (!hasStatistics) {
+        slog::info << "Executable graph doesn't contain per-layer latency statistics. No reports are dumped." << slog::endl;
+        return;
+    }
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_exec_graph_report.csv");
+    dumper << "layerName"
+           << "layerType"
+           << "execType";
+    dumper << "p50 (ms)"
+           << "p90 (ms)"
+           << "p99 (ms)"
+           << "bytes"
+           << "FLOPs"
+           << "FLOPs/byte";
+    dumper.endLine();
+
+    for (const auto& node : ops) {
+        const auto p50 = getRtInfo(node, "execTimeP50Mcs");
+        if (p50.empty())
+            continue;
+        const auto bytes = getRtInfo(node, "bytesMoved");
+        const auto flops = getRtInfo(node, "flops");
+        const double bytesValue = bytes.empty() ? 0.0 : std::stod(bytes);
+        const double flopsValue = flops.empty() ? 0.0 : std::stod(flops);
+
+        dumper << node->get_friendly_name() << getRtInfo(node, "layerType") << getRtInfo(node, "primitiveType");
+        dumper << std::to_string(std::stod(p50) / 1000.0) << std::to_string(std::stod(getRtInfo(node, "execTimeP90Mcs")) / 1000.0)
+               << std::to_string(std::stod(getRtInfo(node, "execTimeP99Mcs")) / 1000.0);
+        dumper << bytes << flops << (bytesValue > 0 ? std::to_string(flopsValue / bytesValue) : "");
+        dumper.endLine();
+    }
+    slog::info << "Executable graph statistics report is stored to " << dumper.getFilename() << slog::endl;
+}
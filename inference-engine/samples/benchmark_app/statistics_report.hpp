@@ -56,6 +56,8 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
 
+    void dumpExecGraphStatistics(const InferenceEngine::CNNNetwork& execGraph);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
@@ -16,6 +16,8 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <chrono>
+#include <future>
 
 #include <legacy/graph_tools.hpp>
 #include <legacy/net_pass.h>
@@ -996,11 +998,8 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
         gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj, config.gnaCompileTarget);
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -1023,6 +1022,52 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // software runtime executes a copy of the components, weights and other read only data stay shared
+            auto relocateRW = [&relocate, this](void *& ptr) {
+                auto base = reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+                auto data = reinterpret_cast<uint8_t *>(ptr);
+                if (data >= base && data < base + rwSegmentSize) {
+                    relocate(ptr, ptr);
+                }
+            };
+            swRequestComponents.push_back(dnn->component);
+            for (auto &component : swRequestComponents.back()) {
+                relocateRW(component.ptr_inputs);
+                relocateRW(component.ptr_outputs);
+                switch (component.operation) {
+                    case kDnnAffineOp:
+                    case kDnnDiagonalOp:
+                        relocateRW(component.op.affine.ptr_weights);
+                        relocateRW(component.op.affine.ptr_biases);
+                        break;
+                    case kDnnConvolutional1dOp:
+                        relocateRW(component.op.conv1D.ptr_filters);
+                        relocateRW(component.op.conv1D.ptr_biases);
+                        break;
+                    case kDnnConvolutional2dOp:
+                        relocateRW(component.op.conv2D.ptr_filters);
+                        relocateRW(component.op.conv2D.ptr_biases);
+                        break;
+                    case kDnnRecurrentOp:
+                        relocateRW(component.op.recurrent.ptr_feedbacks);
+                        relocateRW(component.op.recurrent.ptr_weights);
+                        relocateRW(component.op.recurrent.ptr_biases);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            continue;
+        }
+
+#if GNA_LIB_VER == 2
+        // this can be improved by just copy all structures, but we are too lazy
+        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj, config.gnaCompileTarget);
+#else
+        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+#endif
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -1038,6 +1083,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         }
     }
 
+    // the software inferences are stored by request index, the slots are allocated once here because
+    // QueueInference of one request runs concurrently with waiting on the others
+    swRequests.clear();
+    swRequests.resize(gnaFlags->gna_lib_async_threads_num);
+
     // calculating input orientation without memory layers, since their orientation not changed during infer right now
     std::unordered_map<string, std::vector<string>> skippedLayers;
 
@@ -1104,7 +1154,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice || trivialTopology) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        // requests are executed by the software runtime, but each parallel one still needs its own slot
+        const auto requestsNum = std::max<size_t>(1, gnaModels.size());
+        for (size_t i = 0; i != requestsNum; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -1277,8 +1331,18 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
     if (!gnadevice || trivialTopology) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
+        auto runtime = (idx > 0 && idx <= swRequestComponents.size()) ? runtime::FP(dnn, swRequestComponents[idx - 1]) : runtime::FP(dnn);
+        if (gnaFlags->gna_lib_async_threads_num > 1) {
+            // parallel requests use separate data segments, so they are computed concurrently and synced in WaitFor
+            if (idx >= swRequests.size()) {
+                THROW_GNA_EXCEPTION << "Request index " << idx << " exceeds the number of parallel requests " << swRequests.size();
+            }
+            swRequests[idx] = std::async(std::launch::async, [runtime]() mutable {
+                runtime.infer();
+            });
+        } else {
+            runtime.infer();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -1330,6 +1394,13 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         if (waitStatus == GNA_REQUEST_PENDING) {
             return GNA_REQUEST_PENDING;
         }
+    } else if (request_idx < swRequests.size() && swRequests[request_idx].valid()) {
+        if (swRequests[request_idx].wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        // slot is released even if the software inference failed, the error is passed to the caller
+        std::get<1>(nnets[request_idx]) = -1;
+        swRequests[request_idx].get();
     }
 
     std::get<1>(nnets[request_idx]) = -1;
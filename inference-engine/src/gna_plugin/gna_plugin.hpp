@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
@@ -79,6 +80,15 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      * @brief size of RW segment without extra memory for parallel execution
      */
     uint32_t rwSegmentSize = 0;
+    /**
+     * @brief copies of the dnn components for the parallel requests in GNA_SW_FP32 mode, i-th copy belongs to
+     * request i + 1 and points to its own RW segment
+     */
+    std::vector<std::vector<intel_dnn_component_t>> swRequestComponents;
+    /**
+     * @brief software inferences which are in progress, indexed by request
+     */
+    std::vector<std::future<void>> swRequests;
 
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
@@ -6,9 +6,11 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,15 +39,19 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
-        }
+    std::vector<const float *> filterPtrs(numberOfFilters);
+    for (uint32_t i = 0; i < numberOfFilters; i++) {
+        filterPtrs[i] = filters + i * filterSize;
     }
+
+    // output positions are independent, all the filters are applied to the same input window at once
+    sw_parallel_for(numberOfOutputsPerFilter, filterSize * numberOfFilters, [&](size_t j) {
+        auto outputs = output + j * numberOfFilters;
+        sdot_multi(input + j * convolutionStride, filterPtrs.data(), numberOfFilters, filterSize, outputs);
+        for (uint32_t i = 0; i < numberOfFilters; i++) {
+            outputs[i] += biases[i];
+        }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -137,23 +143,6 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
 }
 } // namespace
 
-float MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
-    const float* input, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const uint32_t poolStrideH,
-    const uint32_t poolStrideW) {
-    float output = std::numeric_limits<float>::lowest();
-    const auto winStartH = oh * poolStrideH;
-    const auto winStartW = ow * poolStrideW;
-    for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
-        for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
-            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, oc, IW, IC);
-            output = (std::max)(output, input[inputIndex]);
-        }
-    }
-    return output;
-}
-
 void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
     float* ptr_outputs = reinterpret_cast<float*>(component->ptr_outputs);
@@ -170,67 +159,28 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = MaxPool2D32SingleHWC(poolWinH, poolWinW,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    poolStrideH,
-                    poolStrideW);
-            }
-        }
-    }
-}
+    // channels are innermost in HWC layout, so the whole pixel is pooled at once
+    sw_parallel_for(OH * OW, OC * poolWinH * poolWinW, [&](size_t pixel) {
+        const auto oh = static_cast<unsigned>(pixel / OW);
+        const auto ow = static_cast<unsigned>(pixel % OW);
+        float* output = ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC);
+        std::fill(output, output + OC, std::numeric_limits<float>::lowest());
 
-#if GNA_LIB_VER == 2
-
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
+        const auto winStartH = oh * poolStrideH;
+        const auto winStartW = ow * poolStrideW;
+        for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
+            for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
+                const float* input = ptr_inputs + getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, 0u, IW, IC);
+                for (unsigned oc = 0; oc < OC; oc++) {
+                    output[oc] = (std::max)(output[oc], input[oc]);
                 }
             }
         }
-    }
-    output += bias;
-    return output;
+    });
 }
 
+#if GNA_LIB_VER == 2
+
 void CNN2DFilter32(intel_dnn_component_t* component) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
     float* ptr_biases = reinterpret_cast<float*>(component->op.conv2D.ptr_biases);
@@ -259,21 +209,55 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if (OH > 0 && (OH - 1) * cSH + kh > IH + 2 * zPH) {
+        THROW_GNA_EXCEPTION << "Output height doesn't fit the padded input!" << layer_name;
+    }
+    if (OW > 0 && (OW - 1) * cSW + kw > IW + 2 * zPW) {
+        THROW_GNA_EXCEPTION << "Output width doesn't fit the padded input!" << layer_name;
+    }
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelSize = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    sw_parallel_for(OH * OW, OC * kh * kw * kc, [&](size_t pixel) {
+        const auto oh = static_cast<uint32_t>(pixel / OW);
+        const auto ow = static_cast<uint32_t>(pixel % OW);
+        float* output = ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC);
+        std::copy(ptr_biases, ptr_biases + OC, output);
+
+        // part of the kernel window which doesn't overlap the zero padding
+        const auto ihStart = static_cast<int64_t>(oh) * cSH - zPH;
+        const auto iwStart = static_cast<int64_t>(ow) * cSW - zPW;
+        const auto khBegin = static_cast<uint32_t>(std::max<int64_t>(0, -ihStart));
+        const auto khEnd = static_cast<uint32_t>(std::min<int64_t>(kh, IH - ihStart));
+        const auto kwBegin = static_cast<uint32_t>(std::max<int64_t>(0, -iwStart));
+        const auto kwEnd = static_cast<uint32_t>(std::min<int64_t>(kw, IW - iwStart));
+        if (khBegin >= khEnd || kwBegin >= kwEnd) {
+            return;
+        }
+
+        // every kernel row is a contiguous run of (kwEnd - kwBegin) * kc elements both in the image and in the filters
+        static thread_local std::vector<const float*> taps;
+        static thread_local std::vector<float> partial;
+        taps.resize(OC);
+        partial.resize(OC);
+        for (uint32_t h = khBegin; h < khEnd; h++) {
+            const float* image = ptr_inputs + getQubeIndex(static_cast<uint32_t>(ihStart + h), static_cast<uint32_t>(iwStart + kwBegin), 0u, IW, IC);
+            const auto tapOffset = getQubeIndex(h, kwBegin, 0u, kw, kc);
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                taps[oc] = ptr_filters + oc * kernelSize + tapOffset;
+            }
+            sdot_multi(image, taps.data(), OC, (kwEnd - kwBegin) * kc, partial.data());
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                output[oc] += partial[oc];
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -1,14 +1,96 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software (GNA_SW_FP32) runtime
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
 
+namespace {
+
+// independent partial sums of a single dot product, they let the compiler keep the accumulation in SIMD registers
+constexpr uint32_t kDotLanes = 16;
+// number of vectors multiplied by the same vector at once to reuse its loads
+constexpr uint32_t kDotGroup = 4;
+// size of the packed B columns which are kept in cache while all rows of A are passed over them
+constexpr size_t kPanelBytes = 256 * 1024;
+
+template <uint32_t G>
+inline void sdot_group(const float *a, const float *const *b, const uint32_t K, float *out) {
+    float acc[G][kDotLanes] = {};
+    uint32_t k = 0;
+    for (; k + kDotLanes <= K; k += kDotLanes) {
+        for (uint32_t g = 0; g < G; g++) {
+            for (uint32_t l = 0; l < kDotLanes; l++) {
+                acc[g][l] += a[k + l] * b[g][k + l];
+            }
+        }
+    }
+    for (uint32_t g = 0; g < G; g++) {
+        float sum = 0.0f;
+        for (uint32_t l = 0; l < kDotLanes; l++) {
+            sum += acc[g][l];
+        }
+        for (uint32_t kk = k; kk < K; kk++) {
+            sum += a[kk] * b[g][kk];
+        }
+        out[g] = sum;
+    }
+}
+
+// dst[j * rows + k] = src[k * ld + j], i.e. makes the columns of the row major matrix contiguous
+const float *pack_columns(const float *src, const MKL_INT ld, const MKL_INT rows, const MKL_INT cols, std::vector<float> &dst) {
+    dst.resize(static_cast<size_t>(rows) * cols);
+    for (MKL_INT k = 0; k < rows; k++) {
+        for (MKL_INT j = 0; j < cols; j++) {
+            dst[static_cast<size_t>(j) * rows + k] = src[static_cast<size_t>(k) * ld + j];
+        }
+    }
+    return dst.data();
+}
+
+// store(i, j, dot(row_a(i), col_b(j))) for i in [0, M) and j in [0, N), both vectors are contiguous and have K elements;
+// columns are processed by cache sized panels, rows of the panel are split between the threads
+template <typename RowA, typename ColB, typename Store>
+void sgemm_dot(const MKL_INT M, const MKL_INT N, const MKL_INT K, const RowA &row_a, const ColB &col_b, const Store &store) {
+    if (M <= 0 || N <= 0) {
+        return;
+    }
+    const auto depth = static_cast<uint32_t>(std::max<MKL_INT>(K, 0));
+    const auto panel = std::max<MKL_INT>(kDotGroup, static_cast<MKL_INT>(kPanelBytes / (sizeof(float) * std::max<uint32_t>(depth, 1))));
+    for (MKL_INT j0 = 0; j0 < N; j0 += panel) {
+        const MKL_INT j1 = std::min(N, j0 + panel);
+        sw_parallel_for(static_cast<size_t>(M), static_cast<size_t>(depth) * (j1 - j0), [&](size_t row) {
+            const auto i = static_cast<MKL_INT>(row);
+            const float *a = row_a(i);
+            const float *b[kDotGroup];
+            float sum[kDotGroup];
+            MKL_INT j = j0;
+            for (; j + static_cast<MKL_INT>(kDotGroup) <= j1; j += kDotGroup) {
+                for (uint32_t g = 0; g < kDotGroup; g++) {
+                    b[g] = col_b(j + g);
+                }
+                sdot_group<kDotGroup>(a, b, depth, sum);
+                for (uint32_t g = 0; g < kDotGroup; g++) {
+                    store(i, j + g, sum[g]);
+                }
+            }
+            for (; j < j1; j++) {
+                b[0] = col_b(j);
+                sdot_group<1>(a, b, depth, sum);
+                store(i, j, sum[0]);
+            }
+        });
+    }
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -19,44 +101,39 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    // packed copies of the operands are reused between the calls made by the same request thread
+    static thread_local std::vector<float> packed_a, packed_b;
+    auto accumulate = [&](MKL_INT i, MKL_INT j, float dot) {
+        float &c = C[i * ldc + j];
+        c = ((beta == 1.0) ? c : 0) + dot;
+    };
+
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        const float *Bt = (N == 1 && ldb == 1) ? B : pack_columns(B, ldb, K, N, packed_b);
+        sgemm_dot(M, N, K,
+                  [&](MKL_INT i) { return A + i * lda; },
+                  [&](MKL_INT j) { return Bt + j * K; },
+                  accumulate);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemm_dot(M, N, K,
+                  [&](MKL_INT i) { return A + i * lda; },
+                  [&](MKL_INT j) { return B + j * ldb; },
+                  [&](MKL_INT i, MKL_INT j, float dot) {
+                      float &c = C[i * ldc + j];
+                      c = beta * c + alpha * dot;
+                  });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        const float *At = pack_columns(A, lda, K, M, packed_a);
+        const float *Bt = (N == 1 && ldb == 1) ? B : pack_columns(B, ldb, K, N, packed_b);
+        sgemm_dot(M, N, K,
+                  [&](MKL_INT i) { return At + i * K; },
+                  [&](MKL_INT j) { return Bt + j * K; },
+                  accumulate);
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +174,38 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
+    static thread_local std::vector<float> packed_a, packed_b;
+    auto accumulate = [&](MKL_INT l, MKL_INT j, float dot) {
+        float &c = C[l * ldc + j];
+        c = ((beta == 1.0) ? c : 0) + dot;
+    };
+
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        const float *Bt = (N == 1 && ldb == 1) ? B : pack_columns(B, ldb, K, N, packed_b);
+        sgemm_dot(L, N, K,
+                  [&](MKL_INT l) { return A + OutputList[l] * lda; },
+                  [&](MKL_INT j) { return Bt + j * K; },
+                  accumulate);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
-            }
-        }
+        sgemm_dot(M, L, K,
+                  [&](MKL_INT i) { return A + i * lda; },
+                  [&](MKL_INT l) { return B + OutputList[l] * ldb; },
+                  [&](MKL_INT i, MKL_INT l, float dot) {
+                      float &c = C[i * ldc + l];
+                      c = beta * c + alpha * dot;
+                  });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        const float *At = pack_columns(A, lda, K, M, packed_a);
+        const float *Bt = (N == 1 && ldb == 1) ? B : pack_columns(B, ldb, K, N, packed_b);
+        sgemm_dot(L, N, K,
+                  [&](MKL_INT l) { return At + OutputList[l] * K; },
+                  [&](MKL_INT j) { return Bt + j * K; },
+                  accumulate);
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -153,19 +221,25 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+    const uint32_t num_columns = K1 + K2;
+
+    sw_parallel_for(N, num_columns, [&](size_t i) {
+        const float *row = X + i * num_columns;
+        float sum[2];
+        sdot_group<1>(A1, &row, K1, &sum[0]);
+        row += K1;
+        sdot_group<1>(A2, &row, K2, &sum[1]);
+        C[i] = B[i] + sum[0] + sum[1];
+    });
+}
+
+void sdot_multi(const float *A, const float *const *B, const uint32_t num_vectors, const uint32_t K, float *out) {
+    uint32_t i = 0;
+    for (; i + kDotGroup <= num_vectors; i += kDotGroup) {
+        sdot_group<kDotGroup>(A, B + i, K, out + i);
+    }
+    for (; i < num_vectors; i++) {
+        sdot_group<1>(A, B + i, K, out + i);
     }
 }
 
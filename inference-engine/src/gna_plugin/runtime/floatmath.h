@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 
@@ -58,7 +59,31 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C);
+// out[i] = A * B[i] for each of num_vectors vectors of K elements
+void sdot_multi(const float *A, const float *const *B, const uint32_t num_vectors, const uint32_t K, float *out);
 
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <ie_parallel.hpp>
+
+/**
+ * @brief Calls func(i) for i in [0, count) distributing the items between as many threads as the amount of work
+ * justifies, so small layers are computed on the calling thread without the threading overhead
+ */
+template <typename F>
+inline void sw_parallel_for(const size_t count, const size_t work_per_item, const F &func) {
+    constexpr size_t min_work_per_thread = 16 * 1024;
+    if (count == 0) {
+        return;
+    }
+    const auto max_threads = static_cast<size_t>(parallel_get_max_threads());
+    const auto nthr = std::min({max_threads, count, std::max<size_t>(1, count * work_per_item / min_work_per_thread)});
+    InferenceEngine::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+        InferenceEngine::for_1d(ithr, nthr, count, func);
+    });
+}
+#endif
@@ -16,17 +16,18 @@ void FP::infer() {
         THROW_GNA_EXCEPTION << "[GNA FP32 RUNTIME] not initialized";
     }
 
-    for (uint32_t i = 0; i < dnn->component.size(); i++) {
-        intel_dnn_component_t *comp = &dnn->component[i];
+    auto &component = components != nullptr ? *components : dnn->component;
+    for (uint32_t i = 0; i < component.size(); i++) {
+        intel_dnn_component_t *comp = &component[i];
         uint32_t *ptr_active_outputs = nullptr;
         uint32_t num_active_outputs = (comp->orientation_out == kDnnInterleavedOrientation)
                                       ? comp->num_rows_out : comp->num_columns_out;
 
-        if (i == dnn->component.size() - 1) {  // active list applies to last component
+        if (i == component.size() - 1) {  // active list applies to last component
             ptr_active_outputs = dnn->ptr_active_outputs();
             num_active_outputs = dnn->num_active_outputs();
-        } else if (i == dnn->component.size() - 2) {  // also applies to last two components when last is PWL
-            if ((dnn->component[i].operation == kDnnAffineOp) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
+        } else if (i == component.size() - 2) {  // also applies to last two components when last is PWL
+            if ((component[i].operation == kDnnAffineOp) && (component[i + 1].operation == kDnnPiecewiselinearOp)) {
                 ptr_active_outputs = dnn->ptr_active_outputs();
                 num_active_outputs = dnn->num_active_outputs();            }
         }
@@ -41,8 +42,8 @@ void FP::infer() {
                 break;
             }
             case kDnnRecurrentOp: {
-                if ((i < dnn->component.size() - 1) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
-                    intel_dnn_component_t *comp_pwl = &dnn->component[i + 1];
+                if ((i < component.size() - 1) && (component[i + 1].operation == kDnnPiecewiselinearOp)) {
+                    intel_dnn_component_t *comp_pwl = &component[i + 1];
                     for (uint32_t j = 0; j < comp->num_rows_in; j++) {
                         void *ptr_feedbacks =
                             reinterpret_cast<void *>(reinterpret_cast<int32_t *>(comp->op.recurrent.ptr_feedbacks)
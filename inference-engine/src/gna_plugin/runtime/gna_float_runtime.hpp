@@ -12,10 +12,16 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    std::vector<intel_dnn_component_t> *components = nullptr;
 
  public:
     FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
     }
+    /**
+     * @brief runs a copy of the dnn components which points to the data segment of a parallel infer request
+     */
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn, std::vector<intel_dnn_component_t> &components) : dnn(dnn), components(&components) {
+    }
     virtual void infer();
 
     /**
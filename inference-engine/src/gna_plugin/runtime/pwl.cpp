@@ -25,6 +25,7 @@
 #endif
 
 #include "pwl.h"
+#include "floatmath.h"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -952,6 +953,46 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+// number of columns of a single row processed as one work item
+constexpr uint32_t kPwlColumnBlock = 1024;
+
+// func(row, in, out, count) is called for the pieces of the rows [num_row_start, num_row_end] restricted to the columns
+// [num_col_start, num_col_end]; long rows are split into blocks so interleaved outputs with few rows use all the threads
+template <typename F>
+void PwlApply32Rows(const float *ptr_in, float *ptr_out, uint32_t num_columns,
+                    uint32_t num_row_start, uint32_t num_row_end,
+                    uint32_t num_col_start, uint32_t num_col_end,
+                    const F &func) {
+    if (num_row_end < num_row_start || num_col_end < num_col_start) {
+        return;
+    }
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    const uint32_t num_blocks = (num_cols + kPwlColumnBlock - 1) / kPwlColumnBlock;
+    sw_parallel_for(static_cast<size_t>(num_rows) * num_blocks, std::min(num_cols, kPwlColumnBlock), [&](size_t item) {
+        const auto i = num_row_start + static_cast<uint32_t>(item / num_blocks);
+        const auto j = num_col_start + static_cast<uint32_t>(item % num_blocks) * kPwlColumnBlock;
+        const auto offset = static_cast<size_t>(i) * num_columns + j;
+        func(i, ptr_in + offset, ptr_out + offset, std::min(kPwlColumnBlock, num_col_end + 1 - j));
+    });
+}
+
+// same as above for activations which don't depend on the row, the inner loop is simple enough to be vectorized
+template <typename F>
+void PwlApply32Elementwise(const float *ptr_in, float *ptr_out, uint32_t num_columns,
+                           uint32_t num_row_start, uint32_t num_row_end,
+                           uint32_t num_col_start, uint32_t num_col_end,
+                           const F &func) {
+    PwlApply32Rows(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+        [&](uint32_t, const float *in, float *out, uint32_t count) {
+            for (uint32_t j = 0; j < count; j++) {
+                out[j] = func(in[j]);
+            }
+        });
+}
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -963,147 +1004,92 @@ void PwlApply32(intel_dnn_component_t *component,
     uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return 0.5 * (1.0 + tanh(0.5 * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return tanh(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [negative_slope](float x) { return (x < 0.0f) ? x * negative_slope : x; });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return x; });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [upper_limit, lower_limit](float x) { return (x > upper_limit) ? upper_limit : ((x < lower_limit) ? lower_limit : x); });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return (x == 0) ? 0.0f : ((x > 0) ? 1.0f : -1.0f); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return -0.5 * log(x); });
             break;
         case kActPow: {
-                float exponent = transform->func_id.args.pow.exponent;
-                float scale = transform->func_id.args.pow.scale;
-                float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
-                    }
-                }
-            }
+            float exponent = transform->func_id.args.pow.exponent;
+            float scale = transform->func_id.args.pow.scale;
+            float offset = transform->func_id.args.pow.offset;
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [exponent, scale, offset](float x) { return pow(offset + scale * x, exponent); });
             break;
+        }
         case kActFakeQuantize: {
-            bool clamping = true;
             double levels  = transform->func_id.fqParams.levels;
-
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
-                auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
-
-                double input_low   = transform->func_id.fqParams.input_low[inputChannel];
-                double input_high  = transform->func_id.fqParams.input_high[inputChannel];
-                double output_low  = transform->func_id.fqParams.output_low[outputChannel];
-                double output_high = transform->func_id.fqParams.output_high[outputChannel];
-
-                auto scaleInput = (levels - 1) / (input_high - input_low);
-                auto scaleOutput = (levels - 1) / (output_high - output_low);
-
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    auto offset = i * num_columns + j;
-                    auto x = ptr_in[offset];
-                    if (!clamping) {
-                        ptr_out[offset] = ptr_in[offset] * scaleInput / scaleOutput;
-                        continue;
-                    }
-
-                    if (x <= std::min(input_low, input_high)) {
-                        ptr_out[offset] = output_low;
-                    } else if (x > std::max(input_low, input_high)) {
-                        ptr_out[offset] = output_high;
-                    } else {
-                        ptr_out[offset] = nearbyint((x - input_low) / (input_high - input_low) * (levels - 1)) /
-                            (levels - 1) * (output_high - output_low) + output_low;
+            PwlApply32Rows(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [&](uint32_t i, const float *in, float *out, uint32_t count) {
+                    auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
+                    auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
+
+                    double input_low   = transform->func_id.fqParams.input_low[inputChannel];
+                    double input_high  = transform->func_id.fqParams.input_high[inputChannel];
+                    double output_low  = transform->func_id.fqParams.output_low[outputChannel];
+                    double output_high = transform->func_id.fqParams.output_high[outputChannel];
+                    const double input_min = std::min(input_low, input_high);
+                    const double input_max = std::max(input_low, input_high);
+
+                    for (uint32_t j = 0; j < count; j++) {
+                        auto x = in[j];
+                        if (x <= input_min) {
+                            out[j] = output_low;
+                        } else if (x > input_max) {
+                            out[j] = output_high;
+                        } else {
+                            out[j] = nearbyint((x - input_low) / (input_high - input_low) * (levels - 1)) /
+                                (levels - 1) * (output_high - output_low) + output_low;
+                        }
                     }
-                }
-            }
+                });
             break;
         }
         case kActCustom:
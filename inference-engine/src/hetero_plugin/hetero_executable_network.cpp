@@ -784,9 +784,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // Every infer request owns its own subgraph requests and intermediate blobs, so the subgraphs form
+        // a pipeline: while one request is at the subgraph N, another one can be at the subgraph N + 1.
+        // A request occupies a single stage at a time, so to keep every subgraph busy with its own optimal
+        // number of requests the stages' numbers are summed up
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
@@ -12,13 +12,21 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph_ops/framework_node.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -62,6 +70,228 @@ public:
     }
 };
 
+// Hashes raw constant data. Large buffers are split into fixed-size chunks which are hashed
+// in parallel, so the result does not depend on the number of threads
+static std::size_t hash_buffer(const char* data, std::size_t size) {
+    auto hashChunk = [](const char* chunk, std::size_t chunkSize) {
+        // FNV-1a over 64-bit words
+        std::uint64_t res = 0xcbf29ce484222325ull;
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= chunkSize; i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, chunk + i, sizeof(word));
+            res = (res ^ word) * 0x100000001b3ull;
+        }
+        for (; i < chunkSize; i++) {
+            res = (res ^ static_cast<std::uint8_t>(chunk[i])) * 0x100000001b3ull;
+        }
+        return static_cast<std::size_t>(res);
+    };
+
+    constexpr std::size_t chunkSize = 1 << 20;
+    const std::size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+    if (chunksNum <= 1) {
+        return hash_combine(hashChunk(data, size), size);
+    }
+
+    std::vector<std::size_t> chunkHashes(chunksNum);
+    parallel_for(chunksNum, [&](std::size_t i) {
+        const std::size_t offset = i * chunkSize;
+        chunkHashes[i] = hashChunk(data + offset, std::min(chunkSize, size - offset));
+    });
+
+    std::size_t seed = size;
+    for (auto chunkHash : chunkHashes) {
+        seed = hash_combine(seed, chunkHash);
+    }
+    return seed;
+}
+
+static bool hash_function(const ngraph::Function& function, std::size_t& seed);
+
+// Feeds operation attributes to the hash without building any intermediate representation.
+// Attributes of unknown types are reported via isSupported(), the caller is expected to
+// fall back to the serialization based hash in that case
+class AttributeHashVisitor final : public ngraph::AttributeVisitor {
+    std::size_t& m_seed;
+    bool m_supported = true;
+
+    template <typename T>
+    void hashScalar(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, adapter.get());
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        m_seed = hash_combine(m_seed, name);
+        const auto& values = adapter.get();
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values) {
+            m_seed = hash_combine(m_seed, value);
+        }
+    }
+
+    void hashInputDescriptions(const std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>& descriptions) {
+        using SubGraphOp = ngraph::op::util::SubGraphOp;
+        for (const auto& desc : descriptions) {
+            m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+            m_seed = hash_combine(m_seed, desc->m_input_index);
+            m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+            if (auto slice = ngraph::as_type_ptr<SubGraphOp::SliceInputDescription>(desc)) {
+                m_seed = hash_combine(m_seed, slice->m_start);
+                m_seed = hash_combine(m_seed, slice->m_stride);
+                m_seed = hash_combine(m_seed, slice->m_part_size);
+                m_seed = hash_combine(m_seed, slice->m_end);
+                m_seed = hash_combine(m_seed, slice->m_axis);
+            } else if (auto merged = ngraph::as_type_ptr<SubGraphOp::MergedInputDescription>(desc)) {
+                m_seed = hash_combine(m_seed, merged->m_body_value_index);
+            }
+        }
+    }
+
+    void hashOutputDescriptions(const std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>& descriptions) {
+        using SubGraphOp = ngraph::op::util::SubGraphOp;
+        for (const auto& desc : descriptions) {
+            m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+            m_seed = hash_combine(m_seed, desc->m_body_value_index);
+            m_seed = hash_combine(m_seed, desc->m_output_index);
+            if (auto concat = ngraph::as_type_ptr<SubGraphOp::ConcatOutputDescription>(desc)) {
+                m_seed = hash_combine(m_seed, concat->m_start);
+                m_seed = hash_combine(m_seed, concat->m_stride);
+                m_seed = hash_combine(m_seed, concat->m_part_size);
+                m_seed = hash_combine(m_seed, concat->m_end);
+                m_seed = hash_combine(m_seed, concat->m_axis);
+            } else if (auto body = ngraph::as_type_ptr<SubGraphOp::BodyOutputDescription>(desc)) {
+                m_seed = hash_combine(m_seed, body->m_iteration);
+            }
+        }
+    }
+
+public:
+    explicit AttributeHashVisitor(std::size_t& seed) : m_seed(seed) {}
+
+    bool isSupported() const { return m_supported; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>>>(&adapter)) {
+            hashInputDescriptions(a->get());
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>>>(&adapter)) {
+            hashOutputDescriptions(a->get());
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            m_seed = hash_combine(m_seed, hash_buffer(buffer->get_ptr<char>(), buffer->size()));
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            for (const auto& attr : attrs) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, hash_buffer(static_cast<const char*>(adapter.get_ptr()), adapter.size()));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { hashScalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { hashScalar(name, adapter); }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { hashVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { hashVector(name, adapter); }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (!hash_function(*adapter.get(), m_seed)) {
+            m_supported = false;
+        }
+    }
+};
+
+// Walks the function in topological order and hashes operation types, attributes, connections
+// and output descriptors. Returns false if some attribute can't be hashed this way
+static bool hash_function(const ngraph::Function& function, std::size_t& seed) {
+    const auto ops = function.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, std::size_t> opIndices;
+    opIndices.reserve(ops.size());
+
+    seed = hash_combine(seed, ops.size());
+    for (const auto& op : ops) {
+        const auto opIndex = opIndices.size();
+        opIndices[op.get()] = opIndex;
+
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.version);
+        seed = hash_combine(seed, op->get_friendly_name());
+
+        for (const auto& input : op->inputs()) {
+            const auto& source = input.get_source_output();
+            seed = hash_combine(seed, opIndices.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+        }
+
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            const auto& shape = output.get_partial_shape();
+            seed = hash_combine(seed, shape.rank().is_static());
+            if (shape.rank().is_static()) {
+                for (const auto& dim : shape) {
+                    seed = hash_combine(seed, dim.get_min_length());
+                    seed = hash_combine(seed, dim.get_max_length());
+                }
+            }
+        }
+
+        AttributeHashVisitor visitor(seed);
+        op->visit_attributes(visitor);
+        if (!visitor.isSupported()) {
+            return false;
+        }
+    }
+
+    // Order of parameters and results defines the function signature
+    for (const auto& parameter : function.get_parameters()) {
+        seed = hash_combine(seed, opIndices.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        seed = hash_combine(seed, opIndices.at(result.get()));
+    }
+    return true;
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -87,24 +317,29 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
 
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Compute hash directly on the graph: operations, attributes and constants data
     size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    if (!hash_function(*network.getFunction(), seed)) {
+        // Some attributes are not known to the hash visitor, use serialized representation instead
+        OstreamHashWrapper xmlHash;
+        OstreamHashWrapper binHash;
+        std::ostream xml(&xmlHash);
+        std::ostream bin(&binHash);
+
+        CNNNetwork net(network);
+        ngraph::pass::Serialize serializer(xml, bin,
+            ngraph::pass::Serialize::Version::IR_V10);
+        serializer.run_on_function(net.getFunction());
+
+        seed = 0;
+        seed = hash_combine(seed, xmlHash.getResult());
+        seed = hash_combine(seed, binHash.getResult());
+    }
 
+    // 2. Add compile options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
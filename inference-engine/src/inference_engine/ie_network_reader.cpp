@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -193,28 +194,41 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                Blob::Ptr weights;
+                {
+                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
+                    // Map weights file to memory: constants of the function reference the mapping directly,
+                    // so the data is neither copied nor duplicated between processes reading the same model
+                    const long long binSize = FileUtils::fileSize(bPath);
+                    if (binSize > 0) {
+                        weights = make_shared_blob<uint8_t>({Precision::U8, { static_cast<size_t>(binSize) }, C },
+                                                            CreateMmapAllocator(bPath));
+                        weights->allocate();
+                        if (weights->cbuffer() == nullptr)
+                            weights.reset();
+                    }
+
+                    if (!weights) {
+                        // Fall back to the regular read if the file can't be mapped
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
+                        std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
-                std::string weights_path = bPath;
+                        std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
-                {
-                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                        std::ifstream binStream;
+                        binStream.open(weights_path, std::ios::binary);
+                        if (!binStream.is_open())
+                            IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                        binStream.seekg(0, std::ios::end);
+                        size_t streamSize = binStream.tellg();
+                        binStream.seekg(0, std::ios::beg);
+
+                        weights = make_shared_blob<uint8_t>({Precision::U8, { streamSize }, C });
+                        weights->allocate();
+                        binStream.read(weights->buffer(), streamSize);
+                        binStream.close();
+                    }
                 }
 
                 // read model with weights
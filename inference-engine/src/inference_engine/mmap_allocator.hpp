@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_allocator.hpp"
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates an allocator which maps a file into memory instead of allocating heap memory.
+ * The mapping is copy-on-write: pages are shared in the page cache between processes until written.
+ * alloc() returns nullptr if the file can't be mapped or the requested size exceeds the file size,
+ * so callers are expected to fall back to a regular allocation.
+ * @param path Path to the file to map
+ * @return Allocator object
+ */
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mmap_allocator.hpp"
+
+namespace InferenceEngine {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path) : _path(path) {}
+
+    ~MmapAllocator() {
+        unmap();
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_data != nullptr)
+            return nullptr;
+
+        int fd = open(_path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return nullptr;
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1 || size == 0 || size > static_cast<size_t>(sb.st_size)) {
+            close(fd);
+            return nullptr;
+        }
+
+        // MAP_PRIVATE keeps the file untouched if somebody modifies the data in place
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // the mapping holds its own reference to the file
+        close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        _data = data;
+        _size = size;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr || handle != _data)
+            return false;
+        unmap();
+        return true;
+    }
+
+private:
+    void unmap() noexcept {
+        if (_data != nullptr) {
+            munmap(_data, _size);
+            _data = nullptr;
+            _size = 0;
+        }
+    }
+
+    std::string _path;
+    void* _data = nullptr;
+    size_t _size = 0;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+
+#include "mmap_allocator.hpp"
+#include "file_utils.h"
+
+namespace InferenceEngine {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path) : _path(path) {}
+
+    ~MmapAllocator() {
+        unmap();
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_data != nullptr || size == 0)
+            return nullptr;
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+        std::wstring path;
+        try {
+            path = FileUtils::multiByteCharToWString(_path.c_str());
+        } catch (...) {
+            return nullptr;
+        }
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || size > static_cast<size_t>(fileSize.QuadPart)) {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        // the mapping object holds its own reference to the file
+        CloseHandle(file);
+        if (mapping == nullptr)
+            return nullptr;
+
+        // FILE_MAP_COPY keeps the file untouched if somebody modifies the data in place
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+        CloseHandle(mapping);
+        if (data == nullptr)
+            return nullptr;
+
+        _data = data;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr || handle != _data)
+            return false;
+        unmap();
+        return true;
+    }
+
+private:
+    void unmap() noexcept {
+        if (_data != nullptr) {
+            UnmapViewOfFile(_data);
+            _data = nullptr;
+        }
+    }
+
+    std::string _path;
+    void* _data = nullptr;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace InferenceEngine
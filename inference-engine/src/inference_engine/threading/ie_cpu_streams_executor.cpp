@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -24,6 +25,82 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue of tasks.
+ *        Each cell carries a sequence number which tells producers and consumers
+ *        whether the cell is free to write or ready to read, so neither side takes a lock
+ */
+class BoundedTaskQueue {
+public:
+    explicit BoundedTaskQueue(std::size_t capacity) :
+        _cells{new Cell[capacity]},
+        _mask{capacity - 1} {
+        assert((capacity >= 2) && ((capacity & (capacity - 1)) == 0));
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        Task                        _task;
+    };
+    std::unique_ptr<Cell[]>         _cells;
+    const std::size_t               _mask;
+    char                            _pad0[cacheLineSize];
+    std::atomic<std::size_t>        _enqueuePos = {0};
+    char                            _pad1[cacheLineSize];
+    std::atomic<std::size_t>        _dequeuePos = {0};
+    char                            _pad2[cacheLineSize];
+};
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -194,33 +271,74 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new BoundedTaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    for (int spin = 0; !TryPop(streamId, task) && spin < _config._spinWaitIterations; ++spin) {
+                        std::this_thread::yield();
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (!task) {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        ++_sleepingThreads;
+                        _queueCondVar.wait(lock, [&] { return (_numTasks > 0) || (stopped = _isStopped); });
+                        --_sleepingThreads;
+                        // Tasks enqueued before stop are still executed
+                        stopped = stopped && (0 == _numTasks);
+                        continue;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
+    /**
+     * @brief Takes a task from the queue of the stream first and steals it from queues of other streams otherwise
+     */
+    bool TryPop(const int streamId, Task& task) {
+        if (0 == _numTasks) {
+            return false;
+        }
+        const int streams = static_cast<int>(_taskQueues.size());
+        for (int i = 0; i < streams; ++i) {
+            if (_taskQueues[(streamId + i) % streams]->TryPop(task)) {
+                --_numTasks;
+                return true;
+            }
+        }
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        if (!_overflowQueue.empty()) {
+            task = std::move(_overflowQueue.front());
+            _overflowQueue.pop_front();
+            --_numTasks;
+            return true;
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
-        {
+        const auto streams = _taskQueues.size();
+        const auto first = _nextTaskQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; !pushed && i < streams; ++i) {
+            pushed = _taskQueues[(first + i) % streams]->TryPush(task);
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace_back(std::move(task));
+        }
+        ++_numTasks;
+        // Threads increment the counter under the mutex before checking for tasks, so either a thread sees
+        // the new task or the counter shows that there is a thread to wake up
+        if (_sleepingThreads > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -256,9 +374,17 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            taskQueueCapacity = 256;
+    // Per stream task queues, idle stream threads steal tasks from queues of other streams
+    std::vector<std::unique_ptr<BoundedTaskQueue>>  _taskQueues;
+    std::atomic<std::size_t>                _nextTaskQueue = {0};
+    // Used only if all the task queues are full
+    std::mutex                              _overflowMutex;
+    std::deque<Task>                        _overflowQueue;
+    std::atomic<int>                        _numTasks = {0};
+    std::atomic<int>                        _sleepingThreads = {0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -94,6 +94,35 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL) == 0) {
+            if (val == PluginConfigParams::YES)
+                interOpParallel = true;
+            else if (val == PluginConfigParams::NO)
+                interOpParallel = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL
+                           << ". Expected only YES/NO";
+        } else if (key.compare(PluginConfigInternalParams::KEY_CPU_REPORT_REFERENCE_FALLBACKS) == 0) {
+            if (val == PluginConfigParams::YES)
+                reportReferenceFallbacks = true;
+            else if (val == PluginConfigParams::NO)
+                reportReferenceFallbacks = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_REPORT_REFERENCE_FALLBACKS
+                           << ". Expected only YES/NO";
+        } else if (key.compare(PluginConfigInternalParams::KEY_CPU_KERNEL_CACHE_CAPACITY) == 0) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+                           << ". Expected only non-negative integer numbers";
+            }
+            kernelCacheCapacity = static_cast<std::size_t>(val_i);
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
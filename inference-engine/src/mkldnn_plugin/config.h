@@ -6,6 +6,7 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include "utils/debug_capabilities.h"
+#include "mkldnn_kernel_cache.hpp"
 
 #include <string>
 #include <map>
@@ -23,8 +24,11 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallel = false;
+    bool reportReferenceFallbacks = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    std::size_t kernelCacheCapacity = MKLDNNKernelCache::defaultCapacity;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -85,7 +85,9 @@ enum Type {
     ExperimentalDetectronPriorGridGenerator,
     ExperimentalDetectronGenerateProposalsSingleImage,
     ExtractImagePatches,
-    NonMaxSuppression
+    NonMaxSuppression,
+    Subgraph,
+    AdaptivePooling
 };
 
 enum Algorithm {
@@ -150,6 +152,10 @@ enum Algorithm {
     FQQuantization,
     FQBinarization,
 
+    // AdaptivePooling algorithms
+    AdaptivePoolingAvg,
+    AdaptivePoolingMax,
+
     // ROIPooling algorithms
     ROIPoolingMax,
     ROIPoolingBilinear,
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+#include "jit_snippets_emitters.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+
+#include <ie_common.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+
+using namespace mkldnn::impl::cpu::x64;
+
+namespace MKLDNNPlugin {
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) -> std::shared_ptr<ngraph::snippets::Emitter> { \
+    return std::make_shared<e_type>(h.get(), isa, n); \
+};
+
+CPUTargetMachine::CPUTargetMachine(cpu_isa_t host_isa) : TargetMachine(), h(new jit_snippet()), isa(host_isa) {
+    // data movement
+    jitters[ngraph::opset1::Parameter::type_info] = CREATE_EMITTER(jit_nop_emitter);
+    jitters[ngraph::snippets::op::BlockedParameter::type_info] = CREATE_EMITTER(jit_nop_emitter);
+    jitters[ngraph::opset1::Result::type_info] = CREATE_EMITTER(jit_nop_emitter);
+    jitters[ngraph::snippets::op::Nop::type_info] = CREATE_EMITTER(jit_nop_emitter);
+
+    jitters[ngraph::snippets::op::Load::type_info] = CREATE_EMITTER(jit_vector_load_emitter);
+    jitters[ngraph::snippets::op::ScalarLoad::type_info] = CREATE_EMITTER(jit_scalar_load_emitter);
+    jitters[ngraph::snippets::op::BroadcastLoad::type_info] = CREATE_EMITTER(jit_broadcast_load_emitter);
+    jitters[ngraph::snippets::op::Store::type_info] = CREATE_EMITTER(jit_vector_store_emitter);
+    jitters[ngraph::snippets::op::ScalarStore::type_info] = CREATE_EMITTER(jit_scalar_store_emitter);
+
+    jitters[ngraph::snippets::op::BroadcastMove::type_info] = CREATE_EMITTER(jit_broadcast_move_emitter);
+    jitters[ngraph::snippets::op::Scalar::type_info] = CREATE_EMITTER(jit_scalar_emitter);
+
+    // unary
+    jitters[ngraph::opset1::Abs::type_info] = CREATE_EMITTER(jit_abs_emitter);
+    jitters[ngraph::opset1::Clamp::type_info] = CREATE_EMITTER(jit_clamp_emitter);
+    jitters[ngraph::opset1::Elu::type_info] = CREATE_EMITTER(jit_elu_emitter);
+    jitters[ngraph::opset1::Erf::type_info] = CREATE_EMITTER(jit_erf_emitter);
+    jitters[ngraph::opset1::Exp::type_info] = CREATE_EMITTER(jit_exp_emitter);
+    jitters[ngraph::opset1::LogicalNot::type_info] = CREATE_EMITTER(jit_logical_not_emitter);
+    jitters[ngraph::opset1::Negative::type_info] = CREATE_EMITTER(jit_negative_emitter);
+    jitters[ngraph::opset1::Relu::type_info] = CREATE_EMITTER(jit_relu_emitter);
+    jitters[ngraph::opset1::Sigmoid::type_info] = CREATE_EMITTER(jit_sigmoid_emitter);
+    jitters[ngraph::opset1::Sqrt::type_info] = CREATE_EMITTER(jit_sqrt_emitter);
+    jitters[ngraph::opset1::Tanh::type_info] = CREATE_EMITTER(jit_tanh_emitter);
+
+    // binary
+    jitters[ngraph::opset1::Add::type_info] = CREATE_EMITTER(jit_add_emitter);
+    jitters[ngraph::opset1::Divide::type_info] = CREATE_EMITTER(jit_divide_emitter);
+    jitters[ngraph::opset1::Equal::type_info] = CREATE_EMITTER(jit_equal_emitter);
+    jitters[ngraph::opset1::FloorMod::type_info] = CREATE_EMITTER(jit_floor_mod_emitter);
+    jitters[ngraph::opset1::Greater::type_info] = CREATE_EMITTER(jit_greater_emitter);
+    jitters[ngraph::opset1::GreaterEqual::type_info] = CREATE_EMITTER(jit_greater_equal_emitter);
+    jitters[ngraph::opset1::Less::type_info] = CREATE_EMITTER(jit_less_emitter);
+    jitters[ngraph::opset1::LessEqual::type_info] = CREATE_EMITTER(jit_less_equal_emitter);
+    jitters[ngraph::opset1::LogicalAnd::type_info] = CREATE_EMITTER(jit_logical_and_emitter);
+    jitters[ngraph::opset1::LogicalOr::type_info] = CREATE_EMITTER(jit_logical_or_emitter);
+    jitters[ngraph::opset1::LogicalXor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::opset1::Maximum::type_info] = CREATE_EMITTER(jit_maximum_emitter);
+    jitters[ngraph::opset1::Minimum::type_info] = CREATE_EMITTER(jit_minimum_emitter);
+    jitters[ngraph::opset1::Mod::type_info] = CREATE_EMITTER(jit_mod_emitter);
+    jitters[ngraph::opset1::Multiply::type_info] = CREATE_EMITTER(jit_multiply_emitter);
+    jitters[ngraph::opset1::NotEqual::type_info] = CREATE_EMITTER(jit_not_equal_emitter);
+    jitters[ngraph::opset1::Power::type_info] = CREATE_EMITTER(jit_power_dynamic_emitter);
+    jitters[ngraph::snippets::op::PowerStatic::type_info] = CREATE_EMITTER(jit_power_static_emitter);
+    jitters[ngraph::opset1::PRelu::type_info] = CREATE_EMITTER(jit_prelu_emitter);
+    jitters[ngraph::opset1::SquaredDifference::type_info] = CREATE_EMITTER(jit_squared_difference_emitter);
+    jitters[ngraph::opset1::Subtract::type_info] = CREATE_EMITTER(jit_subtract_emitter);
+
+    // control flow
+    jitters[ngraph::snippets::op::Kernel::type_info] = CREATE_EMITTER(jit_kernel_emitter);
+    jitters[ngraph::snippets::op::Tile::type_info] = CREATE_EMITTER(jit_tile_emitter);
+}
+
+bool CPUTargetMachine::is_supported() const {
+    return mayiuse(isa) && mkldnn::impl::utils::one_of(isa, sse41, avx2, avx512_common);
+}
+
+ngraph::snippets::code CPUTargetMachine::get_snippet() const {
+    if (h->create_kernel() != mkldnn::impl::status::success) {
+        IE_THROW() << "Failed to create jit kernel for the snippet";
+    }
+    return h->jit_ker();
+}
+
+size_t CPUTargetMachine::get_lanes() const {
+    switch (isa) {
+        case avx2 : return dnnl::impl::cpu::x64::cpu_isa_traits<avx2>::vlen / sizeof(float);
+        case sse41 : return dnnl::impl::cpu::x64::cpu_isa_traits<sse41>::vlen / sizeof(float);
+        case avx512_common : return dnnl::impl::cpu::x64::cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+        default : IE_THROW() << "Unknown isa " << isa;
+    }
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : Generator(std::make_shared<CPUTargetMachine>(isa)) {
+}
+
+}  // namespace MKLDNNPlugin
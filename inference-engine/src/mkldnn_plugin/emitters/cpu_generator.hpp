@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include <snippets/generator.hpp>
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+    ~jit_snippet() = default;
+
+    // the code is emitted by the snippets generator before the kernel is created
+    void generate() override {}
+};
+
+/**
+ * @brief x64 target for the snippets code generator: maps snippets dialect and elementwise operations to the jit emitters
+ */
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    explicit CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+}  // namespace MKLDNNPlugin
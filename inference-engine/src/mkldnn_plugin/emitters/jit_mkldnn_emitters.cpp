@@ -4,6 +4,7 @@
 
 #include "jit_mkldnn_emitters.hpp"
 #include "nodes/mkldnn_eltwise_node.h"
+#include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn::impl::utils;
 using namespace mkldnn::impl;
@@ -14,12 +15,7 @@ namespace MKLDNNPlugin {
 
 jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
     : jit_emitter(host, host_isa, node, exec_prc) {
-
-    kind = mkldnn_eltwise_tanh;
-    alpha = 0.f;
-    beta = 0.f;
-
-    set_injector();
+    // the algorithm is defined by the derived emitters, which create the injector
 }
 
 jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, InferenceEngine::Precision exec_prc)
@@ -84,4 +80,68 @@ jit_mkldnn_aux_emitter::jit_mkldnn_aux_emitter(jit_generator *host, cpu_isa_t ho
     : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
 }
 
+jit_relu_emitter::jit_relu_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_relu;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_sigmoid_emitter::jit_sigmoid_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_logistic;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_tanh_emitter::jit_tanh_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_tanh;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_elu_emitter::jit_elu_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_elu;
+    alpha = static_cast<float>(ngraph::as_type_ptr<ngraph::opset1::Elu>(n)->get_alpha());
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_exp_emitter::jit_exp_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_exp;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_abs_emitter::jit_abs_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    kind = mkldnn_eltwise_abs;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_clamp_emitter::jit_clamp_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+    auto clamp = ngraph::as_type_ptr<ngraph::opset1::Clamp>(n);
+    kind = mkldnn_eltwise_clip;
+    alpha = static_cast<float>(clamp->get_min());
+    beta = static_cast<float>(clamp->get_max());
+
+    set_injector();
+}
+
 } // namespace MKLDNNPlugin
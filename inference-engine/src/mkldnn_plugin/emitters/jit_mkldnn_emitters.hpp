@@ -51,4 +51,47 @@ public:
 private:
 };
 
+// Activations created from ngraph operations, e.g. by the snippets code generator
+class jit_relu_emitter : public jit_mkldnn_emitter {
+public:
+    jit_relu_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                     InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_sigmoid_emitter : public jit_mkldnn_emitter {
+public:
+    jit_sigmoid_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_tanh_emitter : public jit_mkldnn_emitter {
+public:
+    jit_tanh_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                     InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_elu_emitter : public jit_mkldnn_emitter {
+public:
+    jit_elu_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                    InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_exp_emitter : public jit_mkldnn_emitter {
+public:
+    jit_exp_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                    InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_abs_emitter : public jit_mkldnn_emitter {
+public:
+    jit_abs_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                    InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
+class jit_clamp_emitter : public jit_mkldnn_emitter {
+public:
+    jit_clamp_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                      InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+};
+
 } // namespace MKLDNNPlugin
\ No newline at end of file
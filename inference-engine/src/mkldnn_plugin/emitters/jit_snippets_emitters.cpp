@@ -0,0 +1,321 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+#include <ngraph/variant.hpp>
+#include <ngraph/op/constant.hpp>
+#include <snippets/op/tile.hpp>
+#include <snippets/op/kernel.hpp>
+
+#include <set>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// first gpr which keeps the snippet arguments, see AssignRegisters
+constexpr size_t reg64_args_start = 8;
+
+const Reg64 reg_work_amount = Reg64(Operand::R15);
+
+} // namespace
+
+/// KERNEL ///
+jit_kernel_emitter::jit_kernel_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(node);
+    if (!kernel)
+        IE_THROW() << "jit_kernel_emitter is created for the non Kernel operation " << node->get_type_name();
+    code = kernel->region;
+}
+
+size_t jit_kernel_emitter::get_inputs_num() const { return 0; }
+
+void jit_kernel_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    const size_t num_inputs = in_idxs[0];
+    const size_t num_outputs = in_idxs[1];
+    if (num_inputs + num_outputs > SNIPPETS_MAX_ARGS)
+        IE_THROW() << "Snippet has too many arguments: " << num_inputs + num_outputs;
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_inputs; i++)
+        h->mov(Reg64(static_cast<int>(reg64_args_start + i)), h->ptr[abi_param1 + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+    for (size_t i = 0; i < num_outputs; i++)
+        h->mov(Reg64(static_cast<int>(reg64_args_start + num_inputs + i)), h->ptr[abi_param1 + GET_OFF(dst_ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[abi_param1 + GET_OFF(work_amount)]);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, pool_vec_idxs, pool_gpr_idxs);
+
+    h->postamble();
+}
+
+/// TILE ///
+jit_tile_emitter::jit_tile_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(node);
+    if (!tile)
+        IE_THROW() << "jit_tile_emitter is created for the non Tile operation " << node->get_type_name();
+    code = tile->region;
+
+    std::set<size_t> used;
+    for (const auto& c : code) {
+        used.insert(c.second.first.begin(), c.second.first.end());
+        used.insert(c.second.second.begin(), c.second.second.end());
+    }
+    for (size_t idx = 0; idx < get_max_vecs_count(); idx++) {
+        if (used.count(idx) == 0)
+            vec_pool.push_back(idx);
+    }
+}
+
+size_t jit_tile_emitter::get_inputs_num() const { return 0; }
+
+void jit_tile_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                 const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                 const emitter_context *emit_context) const {
+    const size_t increment = in_idxs[0];
+
+    Label for_body;
+    Label for_end;
+
+    h->L(for_body);
+    {
+        h->cmp(reg_work_amount, increment);
+        h->jl(for_end, jit_generator::T_NEAR);
+
+        for (const auto& c : code)
+            c.first->emit_code(c.second.first, c.second.second, vec_pool, {});
+
+        h->sub(reg_work_amount, increment);
+        h->jmp(for_body, jit_generator::T_NEAR);
+    }
+    h->L(for_end);
+}
+
+/// NOP ///
+jit_nop_emitter::jit_nop_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_nop_emitter::get_inputs_num() const { return 0; }
+
+/// BROADCAST MOVE ///
+jit_broadcast_move_emitter::jit_broadcast_move_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node,
+                                                       Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    const auto& in_shape = node->get_input_shape(0);
+    const auto& out_shape = node->get_output_shape(0);
+    is_broadcast = !in_shape.empty() && in_shape.back() == 1 && !out_shape.empty() && out_shape.back() != 1;
+}
+
+size_t jit_broadcast_move_emitter::get_inputs_num() const { return 1; }
+
+void jit_broadcast_move_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_idxs[0]);
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (is_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in_idxs[0]));
+    } else if (out_idxs[0] != in_idxs[0]) {
+        h->uni_vmovups(vmm_dst, vmm_src);
+    }
+}
+
+/// SCALAR ///
+jit_scalar_emitter::jit_scalar_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    // snippets::op::Scalar is derived from Constant, but doesn't have it as a parent in the type info
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        IE_THROW() << "jit_scalar_emitter supports only scalar constants";
+
+    push_arg_entry_of("scalar", float2int(constant->cast_vector<float>()[0]), true);
+    prepare_table();
+}
+
+size_t jit_scalar_emitter::get_inputs_num() const { return 0; }
+
+void jit_scalar_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_scalar_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out_idxs[0]), table_val("scalar"));
+}
+
+/// MEMORY ///
+jit_memory_emitter::jit_memory_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    const auto& rt = node->get_rt_info();
+    const auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Effective address register isn't assigned for " << node->get_friendly_name();
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+
+    const auto& shape = node->get_input_shape(0);
+    is_broadcast = shape.empty() || shape.back() == 1;
+}
+
+jit_vector_load_emitter::jit_vector_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_vector_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_vector_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                        const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                        const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_vector_load_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 reg_src = Reg64(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    // the same element is used for all the lanes if the innermost dimension is broadcasted
+    if (is_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, h->ptr[reg_src]);
+    } else {
+        h->uni_vmovups(vmm_dst, h->ptr[reg_src]);
+        h->add(reg_src, get_vec_length());
+    }
+}
+
+jit_broadcast_load_emitter::jit_broadcast_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node,
+                                                       Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_broadcast_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_broadcast_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_load_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    // BroadcastLoad is created only for the broadcasted innermost dimension, so the pointer isn't moved
+    h->uni_vbroadcastss(Vmm(out_idxs[0]), h->ptr[Reg64(static_cast<int>(ea))]);
+}
+
+jit_scalar_load_emitter::jit_scalar_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_scalar_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_scalar_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                        const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                        const emitter_context *emit_context) const {
+    Reg64 reg_src = Reg64(static_cast<int>(ea));
+    h->uni_vmovss(Xmm(out_idxs[0]), h->ptr[reg_src]);
+    if (!is_broadcast)
+        h->add(reg_src, sizeof(float));
+}
+
+jit_vector_store_emitter::jit_vector_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_vector_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_vector_store_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                         const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                         const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_vector_store_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 reg_dst = Reg64(static_cast<int>(ea));
+
+    // all the lanes keep the same value if the innermost dimension of the output is broadcasted
+    if (is_broadcast) {
+        h->uni_vmovss(h->ptr[reg_dst], Xmm(in_idxs[0]));
+    } else {
+        h->uni_vmovups(h->ptr[reg_dst], Vmm(in_idxs[0]));
+        h->add(reg_dst, get_vec_length());
+    }
+}
+
+jit_scalar_store_emitter::jit_scalar_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_scalar_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_scalar_store_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                         const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                         const emitter_context *emit_context) const {
+    Reg64 reg_dst = Reg64(static_cast<int>(ea));
+    h->uni_vmovss(h->ptr[reg_dst], Xmm(in_idxs[0]));
+    if (!is_broadcast)
+        h->add(reg_dst, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -5,6 +5,8 @@
 #include "mkldnn_edge.h"
 #include "mkldnn_node.h"
 #include "mkldnn_extension_utils.h"
+#include "nodes/mkldnn_input_node.h"
+#include <unordered_set>
 #include <blob_factory.hpp>
 #include "utils/cpu_utils.hpp"
 
@@ -209,6 +211,31 @@ std::string MKLDNNEdge::name() {
             + "<->" + childPtr->getName() + std::to_string(child_port);
 }
 
+std::string MKLDNNEdge::constantSourcesKey() {
+    // The constant inputs are shared by content between the networks, so their memory identifies the weights
+    // the edge value is computed from. It separates the edges of the networks with the same names but different weights.
+    std::string key;
+    std::unordered_set<const MKLDNNNode*> visited;
+    std::vector<MKLDNNNodePtr> stack{getParent()};
+    while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node.get()).second)
+            continue;
+        if (node->getType() == Input && node->isConstant()) {
+            char ptr[32];
+            snprintf(ptr, sizeof ptr, "%p", std::static_pointer_cast<MKLDNNInputNode>(node)->getMemoryPtr()->GetData());
+            key += std::string("_") + ptr;
+            continue;
+        }
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if (auto parentEdge = node->getParentEdgeAt(i))
+                stack.push_back(parentEdge->getParent());
+        }
+    }
+    return key;
+}
+
 void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
     if (status != Status::NeedAllocation)
         return;
@@ -219,7 +246,8 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        externalMemoryKey = name() + constantSourcesKey();
+        auto ptr = weightsCache->findOrCreate(externalMemoryKey, alloc, false);
         memoryPtr = *ptr;
         externalMemoryPtr = true;
         status = Status::Allocated;
@@ -641,6 +669,27 @@ void MKLDNNEdge::validate() {
     status = Status::Validated;
 }
 
+void MKLDNNEdge::reshape(const MKLDNNDims& newDims) {
+    if (getDims() == newDims)
+        return;
+
+    inputDesc = MKLDNNExtensionUtils::reshapeTensorDesc(getInputDesc(), newDims.ToSizeVector());
+    outputDesc = MKLDNNExtensionUtils::reshapeTensorDesc(getOutputDesc(), newDims.ToSizeVector());
+    dims = newDims;
+
+    if (!memoryPtr)
+        return;
+    if (!allocatedSize)
+        allocatedSize = memoryPtr->GetSize();
+
+    // The memory object is redefined in place, so the holders of the pointer see the new descriptor
+    void* data = memoryPtr->GetData();
+    memoryPtr->Create(MKLDNNMemoryDesc(getDesc()), data, false);
+    if (memoryPtr->GetSize() > allocatedSize)
+        IE_THROW() << "Cannot reshape edge " << getParent()->getName() << "->" << getChild()->getName()
+                   << ": the memory of the new shape exceeds the allocated one (" << memoryPtr->GetSize() << ">" << allocatedSize << ").";
+}
+
 MKLDNNEdgePtr MKLDNNEdge::getSharedEdge() const {
     auto memoryFromEdgePtr = memoryFromEdge.lock();
     if (!memoryFromEdgePtr) {
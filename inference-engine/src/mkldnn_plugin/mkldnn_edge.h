@@ -49,6 +49,11 @@ public:
     void reuse(MKLDNNMemoryPtr ptr);
     void validate();
     void drop();
+    /**
+     * @brief Changes the dims of the allocated edge keeping its memory format and the data buffer.
+     * The buffer is allocated for the upper bound shape, so the memory of the new dims must fit it
+     */
+    void reshape(const MKLDNNDims& newDims);
 
     const std::shared_ptr<MKLDNNNode> getParent() const;
     const std::shared_ptr<MKLDNNNode> getChild() const;
@@ -78,6 +83,7 @@ public:
 
 private:
     std::string name();
+    std::string constantSourcesKey();
 
     std::weak_ptr<MKLDNNNode> parent;
     std::weak_ptr<MKLDNNNode> child;
@@ -85,9 +91,12 @@ private:
     int child_port;
 
     bool externalMemoryPtr = false;
+    std::string externalMemoryKey;
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNDims dims;
     MKLDNNMemoryPtr memoryPtr;
+    // Size of the memory the edge is allocated with, the reshaped memory can't exceed it
+    size_t allocatedSize = 0;
     Status status = Status::Uninitialized;
 
     InferenceEngine::TensorDesc getInputDesc();
@@ -11,6 +11,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "utils/serialize.hpp"
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -35,13 +36,15 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const MKLDNNGraphPlan::CPtr &plan) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+        _network(network),
+        _plan(plan) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -129,7 +132,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _plan);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -159,6 +162,21 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::setDynamicShapes(const std::map<std::string, ngraph::PartialShape> &dynamicInputs,
+                                         const std::set<std::string> &dynamicOutputs) {
+    std::set<std::string> inputs;
+    for (const auto& input : dynamicInputs)
+        inputs.insert(input.first);
+    for (auto& g : _graphs) {
+        auto graphLock = Graph::Lock(g);
+        if (graphLock._graph.IsReady()) {
+            graphLock._graph.CheckReshapable(inputs);
+        }
+    }
+    _dynamicInputs = dynamicInputs;
+    _dynamicOutputs = dynamicOutputs;
+}
+
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
@@ -170,6 +188,24 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::Export");
+    if (!_network.getFunction())
+        IE_THROW(NotImplemented) << "Export is not supported for network '" << _name << "'";
+
+    ExportedNetwork exported;
+    exported.network = _network;
+    exported.dynamicInputs = _dynamicInputs;
+    exported.dynamicOutputs = _dynamicOutputs;
+    {
+        auto graphLock = GetGraph();
+        exported.plan = std::make_shared<MKLDNNGraphPlan>(graphLock._graph.GetPlan());
+    }
+
+    CNNNetworkSerializer serializer(modelStream);
+    serializer << exported;
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
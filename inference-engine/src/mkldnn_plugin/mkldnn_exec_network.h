@@ -14,6 +14,7 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -30,16 +31,29 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MKLDNNGraphPlan::CPtr &plan = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Enables inference with input shapes which differ from the shapes the network was compiled for
+     * @param dynamicInputs Shapes of inputs with dynamic dimensions. All the dimensions must be bounded from above,
+     *        the network passed to the constructor is compiled for the upper bounds and the graphs are reshaped
+     *        for the actual input shapes on inference
+     * @param dynamicOutputs Names of outputs which shapes depend on the input shapes
+     */
+    void setDynamicShapes(const std::map<std::string, ngraph::PartialShape> &dynamicInputs,
+                          const std::set<std::string> &dynamicOutputs);
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void Export(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -48,6 +62,8 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
+    // Plan of the imported graph, the graphs of all the streams follow it
+    const MKLDNNGraphPlan::CPtr                 _plan;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
@@ -63,6 +79,10 @@ protected:
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    // Inputs with dynamic dimensions, _network is compiled for the upper bounds of the dimensions
+    std::map<std::string, ngraph::PartialShape> _dynamicInputs;
+    std::set<std::string>                       _dynamicOutputs;
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
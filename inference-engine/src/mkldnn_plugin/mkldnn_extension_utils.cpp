@@ -208,6 +208,19 @@ std::string MKLDNNExtensionUtils::getReorderArgs(const InferenceEngine::TensorDe
     return inArgs + "_" + outArgs;
 }
 
+InferenceEngine::TensorDesc MKLDNNExtensionUtils::reshapeTensorDesc(const InferenceEngine::TensorDesc &desc, const InferenceEngine::SizeVector &dims) {
+    if (desc.getDims() == dims)
+        return desc;
+    if (desc.getLayout() == InferenceEngine::Layout::ANY)
+        return InferenceEngine::TensorDesc(desc.getPrecision(), dims, InferenceEngine::Layout::ANY);
+
+    MKLDNNMemoryDesc mkldnnDesc(desc);
+    auto format = mkldnnDesc.getFormat();
+    if (one_of(format, mkldnn::memory::format_tag::undef, mkldnn::memory::format_tag::any))
+        IE_THROW(NotImplemented) << "Cannot change the dims of the tensor which memory format has no format tag";
+    return MKLDNNMemoryDesc(MKLDNNDims(dims), mkldnnDesc.getDataType(), format);
+}
+
 InferenceEngine::Precision MKLDNNExtensionUtils::getMaxPrecision(std::vector<InferenceEngine::Precision> precisions) {
     if (!precisions.empty()) {
         std::sort(precisions.begin(), precisions.end(),
@@ -81,6 +81,8 @@ public:
     static InferenceEngine::TensorDesc getUninitTensorDesc(const InferenceEngine::TensorDesc& desc);
     static bool initTensorsAreEqual(const InferenceEngine::TensorDesc &desc1, const InferenceEngine::TensorDesc &desc2);
     static std::string getReorderArgs(const InferenceEngine::TensorDesc &parentDesc, const InferenceEngine::TensorDesc &childDesc);
+    /** Returns the descriptor of the same precision and memory format for the other dims */
+    static InferenceEngine::TensorDesc reshapeTensorDesc(const InferenceEngine::TensorDesc &desc, const InferenceEngine::SizeVector &dims);
     static InferenceEngine::Precision getMaxPrecision(std::vector<InferenceEngine::Precision> precisions);
 };
 
@@ -25,8 +25,10 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_reference_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -68,13 +70,14 @@ mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
-        MKLDNNWeightsSharing::Ptr &w_cache) {
+        MKLDNNWeightsSharing::Ptr &w_cache, const MKLDNNGraphPlan::CPtr& plan) {
     OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
 
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    importedPlan = plan;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -85,9 +88,9 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 }
 
 template void MKLDNNGraph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MKLDNNGraphPlan::CPtr&);
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MKLDNNGraphPlan::CPtr&);
 
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -338,10 +341,22 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    compiledPlan.nodes = RecordNodes();
+    followsImportedPlan = importedPlan && importedPlan->nodes == compiledPlan.nodes;
+
+    if (config.interOpParallel)
+        SplitToParallelLevels();
+
     Allocate();
 
     CreatePrimitives();
 
+    if (config.collectPerfCounters) {
+        for (auto &graphNode : graphNodes) {
+            graphNode->PerfCounter().enableHistory();
+        }
+    }
+
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
         graphNode->cleanup();
@@ -357,6 +372,30 @@ void MKLDNNGraph::InitNodes() {
     }
 }
 
+// Selects the primitive descriptor of the exported graph, returns false if the node doesn't support it
+static bool selectImportedPrimitiveDescriptor(MKLDNNNode &node, const MKLDNNGraphPlan::NodeRecord &record) {
+    auto areEqual = [](const std::vector<InferenceEngine::DataConfig> &confs, const std::vector<TensorDesc> &descs) {
+        if (confs.size() != descs.size())
+            return false;
+        for (size_t i = 0; i < confs.size(); i++) {
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(confs[i].desc, descs[i]))
+                return false;
+        }
+        return true;
+    };
+
+    const auto &descriptors = node.getSupportedPrimitiveDescriptors();
+    for (size_t i = 0; i < descriptors.size(); i++) {
+        const auto &config = descriptors[i].getConfig();
+        if (descriptors[i].getImplementationType() == record.implType &&
+            areEqual(config.inConfs, record.inDescs) && areEqual(config.outConfs, record.outDescs)) {
+            node.selectPrimitiveDescriptorByIndex(static_cast<int>(i));
+            return true;
+        }
+    }
+    return false;
+}
+
 void MKLDNNGraph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
 
@@ -376,8 +415,17 @@ void MKLDNNGraph::InitDescriptors() {
         node->filterSupportedPrimitiveDescriptors();
     }
 
+    std::unordered_map<std::string, const MKLDNNGraphPlan::NodeRecord*> importedNodes;
+    if (importedPlan) {
+        for (const auto &record : importedPlan->nodes)
+            importedNodes[record.name] = &record;
+    }
+
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
+        auto imported = importedNodes.find(node->getName());
+        if (imported != importedNodes.end() && selectImportedPrimitiveDescriptor(*node, *imported->second))
+            continue;
         node->selectOptimalPrimitiveDescriptor();
     }
 }
@@ -405,7 +453,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
             auto edgePtr = graphNode->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->externalMemoryKey);
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -418,6 +466,50 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // The outputs of the constant nodes exported with the network are copied, the nodes which results are used
+    // only by the copied outputs aren't executed
+    std::unordered_map<MKLDNNEdge*, const std::vector<uint8_t>*> importedOutputs;
+    if (followsImportedPlan) {
+        for (const auto &constant : importedPlan->constants) {
+            for (auto &edge : graphEdges) {
+                if (edge->getParent()->getName() == constant.parent && edge->getInputNum() == constant.parentPort &&
+                    edge->getChild()->getName() == constant.child && edge->getOutputNum() == constant.childPort) {
+                    if (edge->getMemory().GetSize() == constant.data.size())
+                        importedOutputs[edge.get()] = &constant.data;
+                    break;
+                }
+            }
+        }
+    }
+    std::unordered_set<MKLDNNNode*> importedNodes;
+    if (!importedOutputs.empty()) {
+        for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); ++it) {
+            auto &graphNode = *it;
+            if (!graphNode->isConstant() || graphNode->getChildEdges().empty())
+                continue;
+            bool isImported = true;
+            for (size_t i = 0; i < graphNode->getChildEdges().size() && isImported; ++i) {
+                auto edgePtr = graphNode->getChildEdgeAt(i);
+                isImported = importedOutputs.count(edgePtr.get()) || importedNodes.count(edgePtr->getChild().get());
+            }
+            if (isImported)
+                importedNodes.insert(graphNode.get());
+        }
+    }
+
+    auto execute = [&](MKLDNNNodePtr &graphNode) {
+        if (!importedNodes.count(graphNode.get())) {
+            graphNode->execute(stream);
+            return;
+        }
+        for (size_t i = 0; i < graphNode->getChildEdges().size(); ++i) {
+            auto edgePtr = graphNode->getChildEdgeAt(i);
+            auto imported = importedOutputs.find(edgePtr.get());
+            if (imported != importedOutputs.end())
+                cpu_memcpy(edgePtr->getMemory().GetData(), imported->second->data(), imported->second->size());
+        }
+    };
+
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
@@ -426,13 +518,13 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
             auto sharedOutputs = acquireSharedOutputs(graphNode);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                graphNode->execute(stream);
+                execute(graphNode);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            graphNode->execute(stream);
+            execute(graphNode);
         }
     }
 }
@@ -591,7 +683,7 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     edge_clusters.resize(edge_clusters_count);
 
-    const int64_t alignment = 32;  // 32 bytes
+    const int64_t alignment = 64;  // 64 bytes, the cache line size
 
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
@@ -600,6 +692,11 @@ void MKLDNNGraph::AllocateWithReuse() {
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            // Nodes of one level run concurrently, so the lifetime of a tensor is measured in levels
+            if (!execLevels.empty()) {
+                e_start = execLevels[e_start];
+                e_finish = execLevels[e_finish];
+            }
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -646,8 +743,35 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    auto sameBoxes = [](const std::vector<MemorySolver::Box> &lhs, const std::vector<MemorySolver::Box> &rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+            [](const MemorySolver::Box &l, const MemorySolver::Box &r) {
+                return l.start == r.start && l.finish == r.finish && l.size == r.size && l.id == r.id;
+            });
+    };
+    auto fitWorkspace = [](const MKLDNNGraphPlan &plan) {
+        if (plan.memoryOffsets.size() != plan.memoryBoxes.size())
+            return false;
+        for (size_t i = 0; i < plan.memoryBoxes.size(); i++) {
+            if (plan.memoryOffsets[i] < 0 || plan.memoryOffsets[i] + plan.memoryBoxes[i].size > plan.memorySize)
+                return false;
+        }
+        return true;
+    };
+
+    // The offsets of the exported graph are taken as is if the tensors and their lifetimes are the same
+    compiledPlan.memoryBoxes = boxes;
+    if (followsImportedPlan && sameBoxes(importedPlan->memoryBoxes, boxes) && fitWorkspace(*importedPlan)) {
+        compiledPlan.memoryOffsets = importedPlan->memoryOffsets;
+        compiledPlan.memorySize = importedPlan->memorySize;
+    } else {
+        MemorySolver memSolver(boxes);
+        compiledPlan.memorySize = memSolver.solve();
+        compiledPlan.memoryOffsets.resize(boxes.size());
+        for (int i = 0; i < boxes.size(); i++)
+            compiledPlan.memoryOffsets[i] = memSolver.getOffset(i);
+    }
+    size_t total_size = static_cast<size_t>(compiledPlan.memorySize) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -661,7 +785,7 @@ void MKLDNNGraph::AllocateWithReuse() {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = compiledPlan.memoryOffsets[i];
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
@@ -705,6 +829,46 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+std::vector<MKLDNNGraphPlan::NodeRecord> MKLDNNGraph::RecordNodes() {
+    std::vector<MKLDNNGraphPlan::NodeRecord> records;
+    for (auto &node : graphNodes) {
+        MKLDNNGraphPlan::NodeRecord record;
+        record.name = node->getName();
+        if (auto selectedPD = node->getSelectedPrimitiveDescriptor()) {
+            record.implType = selectedPD->getImplementationType();
+            for (const auto &inConf : selectedPD->getConfig().inConfs)
+                record.inDescs.push_back(inConf.desc);
+            for (const auto &outConf : selectedPD->getConfig().outConfs)
+                record.outDescs.push_back(outConf.desc);
+        }
+        for (const auto &fusedNode : node->getFusedWith())
+            record.fusedWith.push_back(fusedNode->getName());
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+MKLDNNGraphPlan MKLDNNGraph::GetPlan() {
+    if (!IsReady()) IE_THROW() << "Wrong state. Topology not ready.";
+
+    auto plan = compiledPlan;
+    for (auto &edge : graphEdges) {
+        // the constant inputs keep the data of the network, there is no need to export them twice
+        if (!isConstOutput(edge) || edge->getParent()->getType() == Input)
+            continue;
+        MKLDNNGraphPlan::ConstantRecord constant;
+        constant.parent = edge->getParent()->getName();
+        constant.parentPort = edge->getInputNum();
+        constant.child = edge->getChild()->getName();
+        constant.childPort = edge->getOutputNum();
+        const auto &memory = edge->getMemory();
+        const auto data = static_cast<const uint8_t*>(memory.GetData());
+        constant.data.assign(data, data + memory.GetSize());
+        plan.constants.push_back(std::move(constant));
+    }
+    return plan;
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
@@ -738,6 +902,32 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+bool MKLDNNGraph::PushInputDataWithConvert(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodesMap.find(name);
+    if (input == inputNodesMap.end()) {
+        IE_THROW() << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+    }
+
+    // mean image is applied to the FP32 data in place, so it requires the data to be copied as is
+    if (hasMeanImageFor(name))
+        return false;
+
+    const auto& interMemory = input->second->getChildEdgeAt(0)->getMemory();
+    const auto& extDesc = in->getTensorDesc();
+    const auto interPrec = MKLDNNExtensionUtils::DataTypeToIEPrecision(interMemory.GetDataType());
+
+    // element-wise conversion is possible only if the data have the same layout
+    const TensorDesc interDesc = interMemory.GetDesc();
+    if (interDesc != TensorDesc(interPrec, extDesc.getDims(), extDesc.getBlockingDesc()) ||
+        in->size() != interMemory.GetElementsCount())
+        return false;
+
+    cpu_convert(in->cbuffer().as<const void *>(), interMemory.GetPtr(), extDesc.getPrecision(), interPrec, in->size());
+    return true;
+}
+
 void MKLDNNGraph::PullOutputData(const BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
@@ -801,11 +991,103 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::SplitToParallelLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::SplitToParallelLevels");
+
+    parallelLevels.clear();
+    execLevels.clear();
+
+    for (auto &node : graphNodes) {
+        // Memory nodes are linked through the state storage rather than graph edges,
+        // so their relative order can't be derived from the dependency graph
+        if (one_of(node->getType(), MemoryInput, MemoryOutput))
+            return;
+    }
+
+    // graphNodes is sorted topologically, so all the parents of a node already have their levels assigned.
+    // Constant nodes are executed once on load and don't constrain the schedule.
+    std::vector<int> levels(graphNodes.size(), 0);
+    int levelsCount = 0;
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                level = std::max(level, levels[parent->execIndex] + 1);
+        }
+        levels[node->execIndex] = level;
+        if (!node->isConstant())
+            levelsCount = std::max(levelsCount, level + 1);
+    }
+
+    std::vector<std::vector<MKLDNNNodePtr>> nodesByLevel(levelsCount);
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            nodesByLevel[levels[node->execIndex]].push_back(node);
+    }
+
+    // There is nothing to gain if every level contains a single node
+    const auto executableNodesCount = std::count_if(graphNodes.begin(), graphNodes.end(),
+                                                    [](const MKLDNNNodePtr& node) { return !node->isConstant(); });
+    if (nodesByLevel.size() == static_cast<size_t>(executableNodesCount))
+        return;
+
+    parallelLevels = std::move(nodesByLevel);
+    execLevels = std::move(levels);
+}
+
+void MKLDNNGraph::InferParallel(MKLDNNInferRequest* request, int batch) {
+    ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
+
+    for (auto &level : parallelLevels) {
+        if (request != nullptr) {
+            request->ThrowIfCanceled();
+        }
+
+        ENABLE_CPU_DEBUG_CAP(for (auto &node : level) nd.dumpInputBlobs(node));
+
+        auto executeNode = [&](size_t i) {
+            auto &node = level[i];
+            PERF(node);
+
+            if (batch > 0)
+                node->setDynamicBatchLim(batch);
+
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            mkldnn::stream stream(eng);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            // A thread waiting in the parallel region of a node mustn't pick up another node of the level:
+            // both primitives would use the per-thread scratchpad of the thread at the same time
+            tbb::this_task_arena::isolate([&] { node->execute(stream); });
+#else
+            node->execute(stream);
+#endif
+        };
+
+        if (level.size() == 1) {
+            executeNode(0);
+        } else {
+            // Nodes are dispatched to the threads of the current stream arena,
+            // the intra-op parallel regions of the nodes are nested into the same arena
+            // and isolated from each other
+            parallel_for(level.size(), executeNode);
+        }
+
+        ENABLE_CPU_DEBUG_CAP(for (auto &node : level) nd.dumpOutputBlobs(node));
+    }
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
+    if (!parallelLevels.empty()) {
+        InferParallel(request, batch);
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream(eng);
 
     ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
@@ -833,6 +1115,87 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::Reshape(const std::map<std::string, SizeVector> &inputShapes) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::Reshape");
+    if (!IsReady())
+        IE_THROW() << "Wrong state. Topology is not ready.";
+
+    std::unordered_map<MKLDNNNode*, MKLDNNDims> newInputShapes;
+    for (const auto& shape : inputShapes) {
+        auto input = inputNodesMap.find(shape.first);
+        if (input == inputNodesMap.end())
+            IE_THROW() << "Input blob for reshape '" << shape.first << "' doesn't correspond to input in network";
+        newInputShapes.emplace(input->second.get(), MKLDNNDims(shape.second));
+    }
+
+    // The nodes are sorted topologically, so the input edges of a node are already updated when the node is visited
+    std::unordered_set<MKLDNNEdge*> changedEdges;
+    for (auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        std::vector<MKLDNNDims> newInDims;
+        std::vector<MKLDNNDims> newOutDims;
+        bool changed = false;
+        auto input = newInputShapes.find(node.get());
+        if (input != newInputShapes.end()) {
+            newOutDims = {input->second};
+            for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                changed |= node->getChildEdgeAt(i)->getDims() != input->second;
+        } else {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto edge = node->getParentEdgeAt(i);
+                size_t port = edge->getOutputNum();
+                if (newInDims.size() <= port)
+                    newInDims.resize(port + 1);
+                newInDims[port] = edge->getDims();
+                changed |= changedEdges.count(edge.get()) != 0;
+            }
+            if (!changed)
+                continue;
+            newOutDims = node->shapeInfer(newInDims);
+        }
+        if (!changed)
+            continue;
+
+        if (!node->canBeReshaped())
+            IE_THROW(NotImplemented) << "Node " << node->getName() << " of type " << node->getTypeStr() << " can't be reshaped";
+
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            size_t port = edge->getInputNum();
+            if (port >= newOutDims.size())
+                IE_THROW() << "Node " << node->getName() << " has no inferred shape for output port " << port;
+            if (edge->getDims() != newOutDims[port]) {
+                edge->reshape(newOutDims[port]);
+                changedEdges.insert(edge.get());
+            }
+        }
+        node->reshape(newInDims, newOutDims);
+    }
+}
+
+void MKLDNNGraph::CheckReshapable(const std::set<std::string> &inputs) const {
+    std::unordered_set<MKLDNNNode*> dependentNodes;
+    for (const auto& input : inputs) {
+        auto it = inputNodesMap.find(input);
+        if (it != inputNodesMap.end())
+            dependentNodes.insert(it->second.get());
+    }
+
+    for (const auto& node : graphNodes) {
+        bool dependent = dependentNodes.count(node.get()) != 0;
+        for (size_t i = 0; i < node->getParentEdges().size() && !dependent; i++)
+            dependent = dependentNodes.count(node->getParentEdgeAt(i)->getParent().get()) != 0;
+        if (!dependent)
+            continue;
+        if (!node->canBeReshaped())
+            IE_THROW(NotImplemented) << "Node " << node->getName() << " of type " << node->getTypeStr()
+                                     << " can't be reshaped, so it can't depend on the inputs with dynamic shapes";
+        dependentNodes.insert(node.get());
+    }
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -930,10 +1293,16 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
+        std::string layerType = node->typeStr;
+        if (config.reportReferenceFallbacks && node->getType() == Reference) {
+            // the original type shows which operation has no native implementation
+            pdType = "ref_fallback";
+            layerType = dynamic_cast<const MKLDNNReferenceNode&>(*node).getOriginalType();
+        }
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
-        node->typeStr.copy(pc.layer_type, layerTypeLen, 0);
+        layerType.copy(pc.layer_type, layerTypeLen, 0);
 
         for (auto& fusedNode : node->fusedWith) {
             getPerfMapFor(perfMap, fusedNode);
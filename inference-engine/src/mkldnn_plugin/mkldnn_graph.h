@@ -10,7 +10,9 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_graph_plan.h"
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -47,20 +49,44 @@ public:
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
+    /**
+     * @param plan Plan of the graph exported with the network, the graph follows it if the network is the exported one
+     */
     template<typename NET>
     void CreateGraph(NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
-                     MKLDNNWeightsSharing::Ptr &w_cache);
+                     MKLDNNWeightsSharing::Ptr &w_cache,
+                     const MKLDNNGraphPlan::CPtr& plan = nullptr);
+
+    /**
+     * Returns the decisions made on the compilation of the graph together with the current outputs of its constant nodes
+     */
+    MKLDNNGraphPlan GetPlan();
 
     bool hasMeanImageFor(const std::string& name) {
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * Converts the input data directly into the memory of the graph input, so no intermediate blob is needed.
+     * @return false if the input memory has a layout different from the blob one and the data can't be pushed this way
+     */
+    bool PushInputDataWithConvert(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(const InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
+    /**
+     * Changes the shapes of the inputs and propagates them through the graph. The graph is created for the upper bounds
+     * of the shapes, so the memory is kept and only the primitives of the nodes which shapes are changed are recreated.
+     */
+    void Reshape(const std::map<std::string, InferenceEngine::SizeVector> &inputShapes);
+    /**
+     * Checks that all the nodes depending on the given inputs support Reshape(), throws NOT_IMPLEMENTED otherwise
+     */
+    void CheckReshapable(const std::set<std::string> &inputs) const;
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -183,7 +209,11 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        parallelLevels.clear();
+        execLevels.clear();
         _normalizePreprocMap.clear();
+        compiledPlan = {};
+        followsImportedPlan = false;
     }
     Status status { NotReady };
     Config config;
@@ -201,11 +231,21 @@ protected:
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Inter-op parallel schedule: nodes of one level don't depend on each other and are executed concurrently.
+    // execLevels maps node execIndex to its level and is empty if the graph is executed sequentially.
+    std::vector<std::vector<MKLDNNNodePtr>> parallelLevels;
+    std::vector<int> execLevels;
+
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
     bool isQuantizedFlag = false;
 
+    MKLDNNGraphPlan compiledPlan;
+    MKLDNNGraphPlan::CPtr importedPlan;
+    // The graph has the same nodes as the graph of the imported plan, so the plan memory offsets and constants are valid
+    bool followsImportedPlan = false;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -219,6 +259,9 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    std::vector<MKLDNNGraphPlan::NodeRecord> RecordNodes();
+    void SplitToParallelLevels();
+    void InferParallel(MKLDNNInferRequest* request, int batch);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -103,6 +103,15 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    // Latency distribution and roofline inputs, collected only when performance counters are enabled
+    if (node->PerfCounter().hasHistory()) {
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P50] = std::to_string(node->PerfCounter().percentile(50));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P90] = std::to_string(node->PerfCounter().percentile(90));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P99] = std::to_string(node->PerfCounter().percentile(99));
+        serialization_info[ExecGraphInfoSerialization::MEMORY_TRAFFIC] = std::to_string(node->getMemoryTraffic());
+        serialization_info[ExecGraphInfoSerialization::FLOPS] = std::to_string(node->getFlops());
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
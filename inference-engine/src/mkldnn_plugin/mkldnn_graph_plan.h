@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_layouts.h>
+#include "mkldnn/iml_type_mapper.h"
+#include "mkldnn_memory_solver.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Decisions made on the compilation of a graph. They are exported with the network and the graph compiled on import
+ * follows them instead of making them again: the primitive descriptors selected for the nodes, the offsets of the tensors
+ * in the memory workspace and the outputs of the constant nodes, e.g. the weights reordered to the blocked layouts.
+ * The memory offsets and the constants are used only if the compiled graph has the same nodes as the exported one.
+ */
+struct MKLDNNGraphPlan {
+    typedef std::shared_ptr<const MKLDNNGraphPlan> CPtr;
+
+    struct NodeRecord {
+        std::string name;
+        impl_desc_type implType = impl_desc_type::unknown;
+        std::vector<InferenceEngine::TensorDesc> inDescs;
+        std::vector<InferenceEngine::TensorDesc> outDescs;
+        std::vector<std::string> fusedWith;
+
+        bool operator==(const NodeRecord& rhs) const {
+            // the layout isn't compared, the exported descriptors restore only the blocking
+            auto sameDescs = [](const std::vector<InferenceEngine::TensorDesc>& lhs, const std::vector<InferenceEngine::TensorDesc>& rhs) {
+                if (lhs.size() != rhs.size())
+                    return false;
+                for (size_t i = 0; i < lhs.size(); i++) {
+                    if (lhs[i].getPrecision() != rhs[i].getPrecision() || lhs[i].getDims() != rhs[i].getDims() ||
+                        lhs[i].getBlockingDesc() != rhs[i].getBlockingDesc())
+                        return false;
+                }
+                return true;
+            };
+            return name == rhs.name && implType == rhs.implType && fusedWith == rhs.fusedWith &&
+                   sameDescs(inDescs, rhs.inDescs) && sameDescs(outDescs, rhs.outDescs);
+        }
+    };
+
+    // Data passed from a constant node to a non-constant one
+    struct ConstantRecord {
+        std::string parent;
+        int parentPort = 0;
+        std::string child;
+        int childPort = 0;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<NodeRecord> nodes;
+
+    // The tensors allocated in the workspace and their offsets, all in the units of the workspace alignment
+    std::vector<MemorySolver::Box> memoryBoxes;
+    std::vector<int64_t> memoryOffsets;
+    int64_t memorySize = 0;
+
+    std::vector<ConstantRecord> constants;
+};
+
+}  // namespace MKLDNNPlugin
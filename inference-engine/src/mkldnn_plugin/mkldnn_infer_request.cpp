@@ -82,9 +82,18 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
+        // Usually the data can be converted straight into the graph input memory
+        if (graph->PushInputDataWithConvert(inputName, inputBlob))
+            return;
+
+        // Otherwise the conversion is done via intermediate blob which is kept between inferences
+        const InferenceEngine::TensorDesc iconvDesc(inPrec, inputBlob->getTensorDesc().getDims(), inputBlob->getTensorDesc().getLayout());
+        iconv = convertedInputs[inputName];
+        if (!iconv || iconv->getTensorDesc() != iconvDesc) {
+            iconv = make_blob_with_precision(iconvDesc);
+            iconv->allocate();
+            convertedInputs[inputName] = iconv;
+        }
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -173,6 +182,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
+    if (isDynamic()) {
+        // the graph is compiled for the upper bounds of the input shapes, only the nodes which shapes change are updated
+        std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+        for (const auto& input : execNetwork->_dynamicInputs) {
+            inputShapes[input.first] = _inputs.at(input.first)->getTensorDesc().getDims();
+        }
+        graph->Reshape(inputShapes);
+        reallocateDynamicOutputs();
+    }
+
     execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
@@ -230,18 +249,28 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
                 InferenceEngine::SizeVector dims = _networkInputs[name]->getTensorDesc().getDims();
 
+                // The network input has no static shape, so the blob is allocated for the upper bounds of the dimensions
+                if (execNetwork->_dynamicInputs.count(name)) {
+                    dims = execNetwork->_dynamicInputs.at(name).get_max_shape();
+                    l = InferenceEngine::TensorDesc::getLayoutByDims(dims);
+                }
+
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
             _inputs[name] = make_blob_with_precision(desc);
             _inputs[name]->allocate();
-            if (blobs[name]->getTensorDesc() == desc &&
+            if (blobs[name]->getTensorDesc() == desc && !isDynamic() &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        if (execNetwork->_dynamicInputs.count(name)) {
+            checkDynamicInputBlob(data, name);
+        } else {
+            checkBlob(data, name, true);
+        }
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -272,6 +301,12 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
+                // The output shape depends on the input shapes, so the blob is allocated for the shape of the current graph
+                if (execNetwork->_dynamicOutputs.count(name)) {
+                    const auto& dims = blobs[name]->getTensorDesc().getDims();
+                    desc = InferenceEngine::TensorDesc(desc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+                }
+
                 data = make_blob_with_precision(desc);
                 data->allocate();
             } else {
@@ -295,12 +330,17 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
 
             _outputs[name] = data;
-            if (!externalPtr.count(name) && data->getTensorDesc() == blobs[name]->getTensorDesc() && !graph->getProperty().batchLimit) {
+            if (!externalPtr.count(name) && data->getTensorDesc() == blobs[name]->getTensorDesc() && !isDynamic() &&
+                !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        if (execNetwork->_dynamicOutputs.count(name)) {
+            checkBlob(data, name, false, data->getTensorDesc().getDims());
+        } else {
+            checkBlob(data, name, false);
+        }
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -348,6 +388,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (execNetwork->_dynamicInputs.count(name)) {
+            checkDynamicInputBlob(data, name);
+            _inputs[name] = data;
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -371,7 +414,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             if (blobs.find(name) == blobs.end())
                 IE_THROW() << "MKLDNN graph doesn't contain input node with name: " << name;
 
-            if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() &&
+            if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() && !isDynamic() &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -389,19 +432,23 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+        // The shape of the dynamic output is known only after the graph for the input shapes is chosen,
+        // the blob of other shape is replaced by the newly allocated one on inference
+        if (!execNetwork->_dynamicOutputs.count(name)) {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
 
         InferenceEngine::BlobMap blobs;
@@ -409,7 +456,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         if (blobs.find(name) == blobs.end())
             IE_THROW() << "MKLDNN graph doesn't contain output node with name: " << name;
 
-        if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() &&
+        if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() && !isDynamic() &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -496,6 +543,65 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 }
 
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isDynamic() const {
+    return !execNetwork->_dynamicInputs.empty();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkDynamicInputBlob(const InferenceEngine::Blob::Ptr& blob, const std::string& name) const {
+    if (!blob) {
+        IE_THROW(NotAllocated) << "Input data was not allocated.";
+    }
+    const auto& shape = execNetwork->_dynamicInputs.at(name);
+    const auto& dims = blob->getTensorDesc().getDims();
+    if (dims.size() != static_cast<size_t>(shape.rank().get_length())) {
+        IE_THROW(ParameterMismatch) << "Failed to set input blob. Rank mismatch: got " << dims.size()
+                                    << " expecting " << shape.rank().get_length() << " for input '" << name << "'.";
+    }
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (!shape[i].compatible(static_cast<ngraph::Dimension::value_type>(dims[i]))) {
+            IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimension " << i << " of input '" << name << "' is " << dims[i]
+                                        << " which is out of range " << shape[i] << ".";
+        }
+    }
+    checkBlob(blob, name, true, dims);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::reallocateDynamicOutputs() {
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (auto& output : _outputs) {
+        if (!execNetwork->_dynamicOutputs.count(output.first))
+            continue;
+        const auto& dims = blobs.at(output.first)->getTensorDesc().getDims();
+        if (output.second->getTensorDesc().getDims() == dims)
+            continue;
+        InferenceEngine::TensorDesc desc(output.second->getTensorDesc().getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+        output.second = make_blob_with_precision(desc);
+        output.second->allocate();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!isDynamic()) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    for (auto const& input : _inputs) {
+        if (execNetwork->_dynamicInputs.count(input.first)) {
+            checkDynamicInputBlob(input.second, input.first);
+        } else {
+            checkBlob(input.second, input.first, true);
+        }
+    }
+    for (auto const& output : _outputs) {
+        if (execNetwork->_dynamicOutputs.count(output.first)) {
+            checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+        } else {
+            checkBlob(output.second, output.first, false);
+        }
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
     if (!graph->getProperty().enableDynamicBatch)
         IE_THROW() << "Dynamic batch is not enabled.";
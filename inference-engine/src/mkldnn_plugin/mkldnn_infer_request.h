@@ -36,6 +36,8 @@ public:
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
+    void checkBlobs() override;
+
     /**
      * @brief      Sets the pointer to asynchronous inference request that holds this request
      * @param[in]  asyncRequest Pointer to asynchronous inference request
@@ -55,9 +57,16 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+
+    bool isDynamic() const;
+    void checkDynamicInputBlob(const InferenceEngine::Blob::Ptr& blob, const std::string& name) const;
+    void reallocateDynamicOutputs();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    // Intermediate blobs for inputs that can't be converted directly into the graph memory
+    std::map<std::string, InferenceEngine::Blob::Ptr> convertedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_kernel_cache.hpp"
+
+namespace MKLDNNPlugin {
+
+constexpr std::size_t MKLDNNKernelCache::defaultCapacity;
+
+MKLDNNKernelCache& MKLDNNKernelCache::getInstance() {
+    static MKLDNNKernelCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> MKLDNNKernelCache::findOrCreateImpl(const std::string& key, const std::function<std::shared_ptr<void>()>& create) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            kernels.splice(kernels.begin(), kernels, found->second);
+            hits++;
+            return found->second->second;
+        }
+    }
+    misses++;
+
+    // Kernel generation is expensive, so it is done without the lock.
+    // If several threads generate the same kernel concurrently, the first generated one is cached
+    auto kernel = create();
+    if (!kernel)
+        return kernel;
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (capacity == 0)
+        return kernel;
+    auto found = index.find(key);
+    if (found != index.end()) {
+        kernels.splice(kernels.begin(), kernels, found->second);
+        return found->second->second;
+    }
+    kernels.emplace_front(key, kernel);
+    index[key] = kernels.begin();
+    evict();
+    return kernel;
+}
+
+void MKLDNNKernelCache::evict() {
+    while (kernels.size() > capacity) {
+        index.erase(kernels.back().first);
+        kernels.pop_back();
+    }
+}
+
+void MKLDNNKernelCache::setCapacity(std::size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = newCapacity;
+    evict();
+}
+
+std::size_t MKLDNNKernelCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return capacity;
+}
+
+std::size_t MKLDNNKernelCache::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return kernels.size();
+}
+
+void MKLDNNKernelCache::clear() {
+    std::lock_guard<std::mutex> lock(guard);
+    kernels.clear();
+    index.clear();
+    hits = 0;
+    misses = 0;
+}
+
+}  // namespace MKLDNNPlugin
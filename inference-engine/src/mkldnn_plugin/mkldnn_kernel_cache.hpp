@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <unordered_map>
+#include <type_traits>
+#include <functional>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <list>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Key of the cached kernel. Consists of the kernel name and the values which define the generated code
+ * (ISA, data types, layouts, shapes and so on)
+ */
+class MKLDNNKernelKey {
+public:
+    explicit MKLDNNKernelKey(const std::string& kernelName) : key(kernelName) {}
+
+    template <typename T>
+    MKLDNNKernelKey& operator<<(const T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Kernel key field must be arithmetic or enum value");
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        return *this;
+    }
+
+    const std::string& str() const { return key; }
+
+private:
+    std::string key;
+};
+
+/**
+ * Process-wide LRU cache of JIT kernels generated by the plugin nodes.
+ * The kernels are not modified after generation, so one kernel is shared between the graphs of all streams
+ * and executable networks. The cache keeps at most `capacity` kernels, evicted kernels stay alive while they are used.
+ *
+ * Is a thread safe
+ */
+class MKLDNNKernelCache {
+public:
+    static constexpr std::size_t defaultCapacity = 1024;
+
+    static MKLDNNKernelCache& getInstance();
+
+    /**
+     * Returns the cached kernel or generates it with `create` if there is no kernel with such key.
+     * `create` can return nullptr if the kernel can't be generated, nullptr is not cached.
+     */
+    template <typename Kernel>
+    std::shared_ptr<Kernel> findOrCreate(const MKLDNNKernelKey& key, const std::function<std::shared_ptr<Kernel>()>& create) {
+        return std::static_pointer_cast<Kernel>(findOrCreateImpl(key.str(), [&] {
+            return std::static_pointer_cast<void>(create());
+        }));
+    }
+
+    void setCapacity(std::size_t capacity);
+    std::size_t getCapacity() const;
+    std::size_t size() const;
+    void clear();
+
+    std::size_t getHits() const { return hits; }
+    std::size_t getMisses() const { return misses; }
+
+private:
+    MKLDNNKernelCache() = default;
+
+    std::shared_ptr<void> findOrCreateImpl(const std::string& key, const std::function<std::shared_ptr<void>()>& create);
+    void evict();
+
+    using Entry = std::pair<std::string, std::shared_ptr<void>>;
+
+    mutable std::mutex guard;
+    std::size_t capacity = defaultCapacity;
+    // The most recently used kernels are at the front
+    std::list<Entry> kernels;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::atomic<std::size_t> hits = {0};
+    std::atomic<std::size_t> misses = {0};
+};
+
+}  // namespace MKLDNNPlugin
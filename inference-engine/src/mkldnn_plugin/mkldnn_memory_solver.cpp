@@ -8,6 +8,10 @@
 
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <limits>
 #include <vector>
 #include <map>
 
@@ -46,57 +50,120 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+int64_t MemorySolver::place(const std::vector<size_t>& order, const std::vector<std::vector<size_t>>& conflicts,
+                            bool best_fit, std::vector<int64_t>& offsets) const {
+    std::vector<bool> placed(_boxes.size(), false);
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of the memory used by placed conflicting boxes
+    int64_t min_required = 0;
+
+    for (size_t i : order) {
+        const Box& box = _boxes[i];
+        busy.clear();
+        for (size_t j : conflicts[i]) {
+            if (placed[j])
+                busy.emplace_back(offsets[j], offsets[j] + _boxes[j].size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // the lowest (first fit) or the smallest (best fit) gap between the busy ranges which can hold the box,
+        // or the top of the busy ranges
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t free_begin = 0;
+        for (const auto& range : busy) {
+            const int64_t gap = range.first - free_begin;
+            if (gap >= box.size && gap < best_gap) {
+                best_gap = gap;
+                best_offset = free_begin;
+                if (!best_fit)
+                    break;
+            }
+            free_begin = std::max(free_begin, range.second);
+        }
+        if (best_offset == -1)
+            best_offset = free_begin;
+
+        offsets[i] = best_offset;
+        placed[i] = true;
+        min_required = std::max(min_required, best_offset + box.size);
     }
+    return min_required;
 }
 
 int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
-            }
-        } while (popped_up);
+    const int64_t lower_bound = maxDepth();
+    const size_t count = _boxes.size();
+
+    // Boxes are sorted by start, so the box conflicts only with the following boxes which start before it finishes
+    std::vector<std::vector<size_t>> conflicts(count);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = i + 1; j < count && _boxes[j].start <= _boxes[i].finish; j++) {
+            conflicts[i].push_back(j);
+            conflicts[j].push_back(i);
+        }
+    }
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+    auto duration = [](const Box& box) -> int64_t { return box.finish - box.start + 1; };
+    using Less = std::function<bool(const Box&, const Box&)>;
+    const std::vector<Less> orders {
+        [&](const Box& l, const Box& r) { return l.size > r.size || (l.size == r.size && duration(l) > duration(r)); },
+        [&](const Box& l, const Box& r) { return l.size * duration(l) > r.size * duration(r); },
+        [&](const Box& l, const Box& r) { return duration(l) > duration(r) || (duration(l) == duration(r) && l.size > r.size); },
+    };
+
+    std::vector<int64_t> offsets(count), best_offsets(count);
+    std::vector<size_t> best_order;
+    int64_t best = std::numeric_limits<int64_t>::max();
+    bool best_fit = false;
+    for (const auto& less : orders) {
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) { return less(_boxes[l], _boxes[r]); });
+        for (bool fit : {false, true}) {
+            const int64_t required = place(order, conflicts, fit, offsets);
+            if (required < best) {
+                best = required;
+                best_fit = fit;
+                best_order = order;
+                best_offsets = offsets;
+            }
+            if (best == lower_bound)
+                break;
+        }
+        if (best == lower_bound)
+            break;
+    }
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+    // Local search: the box which top is the peak is placed earlier, the new order is kept if it is not worse
+    constexpr int local_search_iterations = 16;
+    std::vector<size_t> order = best_order;
+    for (int iteration = 0; iteration < local_search_iterations && best > lower_bound; iteration++) {
+        auto peak = std::find_if(order.rbegin(), order.rend(), [&](size_t i) {
+            return best_offsets[i] + _boxes[i].size == best;
+        });
+        if (peak == order.rend() || std::next(peak) == order.rend())
+            break;
+        // place the peak box first, so it takes the best gap and the others are fitted around it
+        auto peak_it = std::prev(peak.base());
+        std::rotate(order.begin(), peak_it, std::next(peak_it));
+        const int64_t required = place(order, conflicts, best_fit, offsets);
+        if (required > best)
+            break;
+        best = required;
+        best_offsets = offsets;
     }
 
+    for (size_t i = 0; i < count; i++)
+        _offsets[_boxes[i].id] = best_offsets[i];
+    _min_required = count ? best : 0;
     return _min_required;
 }
 
+int64_t MemorySolver::gap() {
+    if (_min_required == -1) solve();
+    return _min_required - std::max<int64_t>(maxDepth(), 0);
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
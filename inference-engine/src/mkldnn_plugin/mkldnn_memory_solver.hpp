@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <vector>
@@ -42,6 +43,11 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The boxes are placed one by one into the smallest free gap which fits them (best-fit). Several orders of placement
+ *  are tried (by size, by size * live time and by live time), then the best one is refined by the local search which
+ *  moves the box determining the peak to the beginning of the order. maxDepth() is a lower bound of the solution,
+ *  so the search stops as soon as it is reached.
  */
 
 class MemorySolver {
@@ -80,15 +86,20 @@ public:
     int64_t maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
+    /** Additional info. Excess of the solve() result over maxDepth(), the lower bound of required memory. */
+    int64_t gap();
 
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
+    int64_t _min_required = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t place(const std::vector<size_t>& order, const std::vector<std::vector<size_t>>& conflicts,
+                  bool best_fit, std::vector<int64_t>& offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -12,6 +12,7 @@
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
+#include <set>
 
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_conv_node.h>
@@ -223,7 +224,10 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ExperimentalDetectronPriorGridGenerator", ExperimentalDetectronPriorGridGenerator},
         { "ExperimentalDetectronGenerateProposalsSingleImage", ExperimentalDetectronGenerateProposalsSingleImage},
         { "ExtractImagePatches", ExtractImagePatches},
-        { "NonMaxSuppressionIEInternal", NonMaxSuppression}
+        { "NonMaxSuppressionIEInternal", NonMaxSuppression},
+        { "Subgraph", Subgraph},
+        { "AdaptiveAvgPool", AdaptivePooling},
+        { "AdaptiveMaxPool", AdaptivePooling}
 };
 
 Type TypeFromName(const std::string type) {
@@ -248,6 +252,7 @@ MKLDNNNode::MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::en
           type(TypeFromName(op->get_type_name())), profiling(op->get_friendly_name()) {
     algorithm = Algorithm::Undefined;
     fusingPort = -1;
+    originalOp = op;
 
     const std::string errorPrefix = "Ngraph operation " + std::string(op->get_type_name()) + " with name " + op->get_friendly_name();
     for (size_t i = 0; i < op->get_input_size(); i++) {
@@ -784,6 +789,101 @@ void MKLDNNNode::initDescriptor(const InferenceEngine::LayerConfig &config) {
     selectedPD->getConfig() = rightConfig;
 }
 
+std::vector<MKLDNNDims> MKLDNNNode::shapeInfer(const std::vector<MKLDNNDims>& inputDims) const {
+    // The nodes inserted by the graph itself (reorders, converts) don't change the shape of the data
+    if (!originalOp) {
+        if (inputDims.empty())
+            IE_THROW(NotImplemented) << "Node " << getName() << " of type " << getTypeStr() << " can't infer its output shapes";
+        return {inputDims[0]};
+    }
+
+    ngraph::OutputVector inputs;
+    for (size_t i = 0; i < originalOp->get_input_size(); i++) {
+        const auto source = originalOp->input_value(i);
+        if (i >= inputDims.size() || ngraph::is_type<ngraph::op::v0::Constant>(source.get_node())) {
+            inputs.push_back(source);
+            continue;
+        }
+        // the scalars are represented by the tensors of one element in the graph
+        const auto dims = inputDims[i].ToSizeVector();
+        const auto shape = ngraph::is_scalar(source.get_shape()) && dims == ngraph::Shape{1} ? ngraph::Shape{} : ngraph::Shape(dims);
+        inputs.push_back(std::make_shared<ngraph::op::v0::Parameter>(source.get_element_type(), shape));
+    }
+
+    std::shared_ptr<ngraph::Node> op;
+    try {
+        op = originalOp->clone_with_new_inputs(inputs);
+    } catch (const std::exception& e) {
+        IE_THROW(NotImplemented) << "Node " << getName() << " of type " << getTypeStr() << " can't infer its output shapes: " << e.what();
+    }
+
+    std::vector<MKLDNNDims> outputDims;
+    for (size_t i = 0; i < op->get_output_size(); i++) {
+        const auto& shape = op->get_output_partial_shape(i);
+        if (shape.is_dynamic())
+            IE_THROW(NotImplemented) << "Node " << getName() << " of type " << getTypeStr() << " has dynamic output shape " << shape;
+        outputDims.emplace_back(ngraph::is_scalar(shape.to_shape()) ? ngraph::Shape{1} : shape.to_shape());
+    }
+    return outputDims;
+}
+
+void MKLDNNNode::reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims) {
+    auto* selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+
+    // The memory formats were chosen for the upper bound shapes, they are kept for any smaller shape
+    auto& config = selectedPD->getConfig();
+    for (size_t i = 0; i < config.inConfs.size() && i < newInputDims.size(); i++)
+        config.inConfs[i].desc = MKLDNNExtensionUtils::reshapeTensorDesc(config.inConfs[i].desc, newInputDims[i].ToSizeVector());
+    for (size_t i = 0; i < config.outConfs.size() && i < newOutputDims.size(); i++)
+        config.outConfs[i].desc = MKLDNNExtensionUtils::reshapeTensorDesc(config.outConfs[i].desc, newOutputDims[i].ToSizeVector());
+
+    // the primitive of the current dims is kept to be reused when the node returns to them
+    if (prim)
+        reshapedPrimitives.put(getShapesKey(), prim);
+
+    for (size_t i = 0; i < inDims.size() && i < newInputDims.size(); i++)
+        inDims[i] = newInputDims[i];
+    for (size_t i = 0; i < outDims.size() && i < newOutputDims.size(); i++)
+        outDims[i] = newOutputDims[i];
+
+    if (!descs.empty()) {
+        std::vector<InferenceEngine::TensorDesc> inDescs;
+        for (const auto& inConf : config.inConfs)
+            inDescs.push_back(inConf.desc);
+        std::vector<InferenceEngine::TensorDesc> outDescs;
+        for (const auto& outConf : config.outConfs)
+            outDescs.push_back(outConf.desc);
+        descs.clear();
+        createDescriptor(inDescs, outDescs);
+    }
+
+    const auto key = getShapesKey();
+    MKLDNNPrimitive cached;
+    const bool found = reshapedPrimitives.find(key, cached);
+    prim = found ? cached : MKLDNNPrimitive();
+    createPrimitive();
+    if (!found && prim)
+        reshapedPrimitives.put(key, prim);
+}
+
+std::string MKLDNNNode::getShapesKey() const {
+    std::string key;
+    for (const auto& dims : inDims) {
+        for (auto dim : dims.ToSizeVector())
+            key += std::to_string(dim) + ",";
+        key += ";";
+    }
+    key += "|";
+    for (const auto& dims : outDims) {
+        for (auto dim : dims.ToSizeVector())
+            key += std::to_string(dim) + ",";
+        key += ";";
+    }
+    return key;
+}
+
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
@@ -820,14 +920,13 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            // the key doesn't depend on the node, so the nodes of all the networks share identical weights
+            const std::string string_hash = "internal_" + MKLDNNWeightsSharing::GetContentKey(
+                    internalBlob->cbuffer(), internalBlob->byteSize(), internalBlob->getTensorDesc(), intDescs[i]);
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            const auto checksum = MKLDNNWeightsSharing::GetContentChecksum(internalBlob->cbuffer(), internalBlob->byteSize());
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, create, true, checksum);
         } else {
             ptr = create();
         }
@@ -1238,6 +1337,26 @@ InferenceEngine::Precision MKLDNNNode::getRuntimePrecision() const {
     return runtimePrecision;
 }
 
+size_t MKLDNNNode::getMemoryTraffic() const {
+    size_t traffic = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        if (parentEdge && parentEdge->getStatus() == MKLDNNEdge::Status::Validated) {
+            traffic += parentEdge->getMemoryPtr()->GetSize();
+        }
+    }
+    // edges going out of the same port share the memory, so it is written once
+    std::set<int> countedPorts;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto childEdge = getChildEdgeAt(i);
+        if (childEdge && childEdge->getStatus() == MKLDNNEdge::Status::Validated &&
+            countedPorts.insert(childEdge->getInputNum()).second) {
+            traffic += childEdge->getMemoryPtr()->GetSize();
+        }
+    }
+    return traffic;
+}
+
 MKLDNNNode* MKLDNNNode::NodesFactory::create(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
                                              const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache) {
     MKLDNNNode *newNode = nullptr;
@@ -19,6 +19,7 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_shape_cache.hpp"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
@@ -192,6 +193,10 @@ static std::string NameFromType(Type type) {
             return "ExtractImagePatches";
         case NonMaxSuppression:
             return "NonMaxSuppression";
+        case Subgraph:
+            return "Subgraph";
+        case AdaptivePooling:
+            return "AdaptivePooling";
         default:
             return "Unknown";
     }
@@ -481,6 +486,28 @@ public:
      */
     virtual void init() {}
 
+    /**
+     * @brief Returns true if the node is able to recreate its primitive for other input shapes
+     * keeping the selected primitive descriptor (see reshape())
+     */
+    virtual bool canBeReshaped() const {
+        return false;
+    }
+
+    /**
+     * @brief Infers the output dims for the given input dims, the inputs are indexed by port
+     * The default implementation reruns the shape inference of the original ngraph operation
+     */
+    virtual std::vector<MKLDNNDims> shapeInfer(const std::vector<MKLDNNDims>& inputDims) const;
+
+    /**
+     * @brief Changes the dims of the selected primitive descriptor and recreates the primitive for them.
+     * The memory formats of the ports stay the same, the edges must be already updated for the new dims.
+     * The primitives are cached by the dims, so createPrimitive() is called with prim already set if the node had
+     * these dims before. The nodes executing a oneDNN primitive only bind such primitive to the memory then
+     */
+    virtual void reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims);
+
     template <class PD, class D, typename FPD = bool>
     PD createPrimitiveDescriptor(const mkldnn::primitive_attr &attr = mkldnn::primitive_attr()) {
         auto descsEqual = [](const std::vector<InferenceEngine::TensorDesc>& srcDescs,
@@ -566,6 +593,20 @@ public:
      */
     virtual InferenceEngine::Precision getRuntimePrecision() const;
 
+    /**
+     * @brief Returns amount of memory read and written by a single node execution
+     * @return Total size in bytes of the allocated input and output memory
+     */
+    size_t getMemoryTraffic() const;
+
+    /**
+     * @brief Returns estimated number of floating point operations performed by a single node execution
+     * @return FLOPs count or 0 if the node doesn't provide an estimation
+     */
+    virtual uint64_t getFlops() const {
+        return 0;
+    }
+
     const std::vector<InferenceEngine::Precision>& getOriginalInputPrecisions() const {
         return originalInputPrecisions;
     }
@@ -694,6 +735,16 @@ protected:
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
 
+    // The operation the node is created from, it is used by shapeInfer()
+    std::shared_ptr<ngraph::Node> originalOp;
+    // The primitives created for the dims the node was reshaped to
+    MKLDNNShapeCache<MKLDNNPrimitive> reshapedPrimitives;
+
+    /**
+     * @brief Returns the key of the current input and output dims for the caches of the objects created for them
+     */
+    std::string getShapesKey() const;
+
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
 
@@ -7,13 +7,17 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "utils/serialize.hpp"
+#include "ie_icore.hpp"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <set>
 #include <unordered_set>
+#include <algorithm>
 #include <ie_system_conf.h>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -74,6 +78,7 @@
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
 #include <transformations/low_precision/disable_convert_constant_folding_on_const_path.hpp>
+#include <ngraph/pass/constant_folding.hpp>
 #include <low_precision/pull_reshape_through_dequantization.hpp>
 #include <low_precision/pull_transpose_through_dequantization.hpp>
 #include <low_precision/transformer.hpp>
@@ -89,6 +94,9 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/fc_weights_decompression.hpp"
+#include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include <snippets/pass/collapse_subgraph.hpp>
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -113,8 +121,18 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+// Elementwise chains which are not fused into the other nodes are collapsed into JIT compiled subgraphs
+static void TokenizeSnippets(const std::shared_ptr<ngraph::Function>& nGraphFunc) {
+    ngraph::pass::Manager snippetsManager;
+    snippetsManager.register_pass<SnippetsMarkSkipped>();
+    snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+    snippetsManager.run_passes(nGraphFunc);
+}
+
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf, bool enableSnippets = true) {
     auto nGraphFunc = clonedNetwork.getFunction();
+    // the constants are folded within the thread limit of the plugin, 0 means all the hardware threads
+    const auto foldingThreads = static_cast<size_t>(std::max(conf.streamExecutorConfig._threads, 0));
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -125,6 +143,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else {
+        // 4-bit weights of MatMul are kept packed for FullyConnected, see FullyConnectedWeightsDecompression
+        manager.register_pass<DisableFCWeightsDecompressionFolding>();
     }
 
     auto get_convert_precisions = []() {
@@ -136,9 +157,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
             {ngraph::element::u32,     ngraph::element::i32},
             {ngraph::element::f64,     ngraph::element::f32},
             {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-            {ngraph::element::i4,      ngraph::element::i8},
-            {ngraph::element::u4,      ngraph::element::u8}
+            {ngraph::element::boolean, ngraph::element::u8}
         };
 
         if (!with_cpu_x86_avx512_core())
@@ -166,13 +185,18 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::ConvertNMS3ToNMS5>();
     manager.register_pass<ngraph::pass::ConvertNMS4ToNMS5>();
     manager.register_pass<ngraph::pass::ConvertNMSToNMSIEInternal>();
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(foldingThreads);
 
     if (useLpt) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
+    if (useLpt) {
+        // Otherwise 4-bit constants are converted after FullyConnectedWeightsDecompression in ConvertToCPUSpecificOpset
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i4, ngraph::element::i8 },
+                                                                                { ngraph::element::u4, ngraph::element::u8 }});
+    }
 
     auto pass_config = manager.get_pass_config();
 
@@ -367,7 +391,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     postLPTPassManager.run_passes(nGraphFunc);
 
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    ConvertToCPUSpecificOpset(nGraphFunc, foldingThreads);
+
+    if (enableSnippets && !useLpt && !conf.enforceBF16 && with_cpu_x86_avx2()) {
+        TokenizeSnippets(nGraphFunc);
+    }
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -403,16 +431,73 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // Dynamic dimensions are supported only if they are bounded from above. The network is compiled for the upper bounds
+    // and the compiled graph is reshaped for the actual input shapes on inference
+    std::map<std::string, ngraph::PartialShape> dynamicInputs;
+    std::set<std::string> dynamicOutputs;
+    std::map<std::string, SizeVector> upperBoundShapes;
+    if (auto function = network.getFunction()) {
+        for (const auto& parameter : function->get_parameters()) {
+            const auto& pshape = parameter->get_partial_shape();
+            if (pshape.is_static())
+                continue;
+            if (pshape.rank().is_dynamic()) {
+                IE_THROW(NotImplemented) << "Input '" << parameter->get_friendly_name() << "' has dynamic rank which is not supported";
+            }
+            SizeVector upperBound;
+            for (const auto& dim : pshape) {
+                if (!dim.get_interval().has_upper_bound()) {
+                    IE_THROW(NotImplemented) << "Input '" << parameter->get_friendly_name() << "' has unbounded dynamic dimension: "
+                                             << pshape << ". Only dimensions with upper bound are supported";
+                }
+                upperBound.push_back(static_cast<size_t>(dim.get_max_length()));
+            }
+            dynamicInputs[parameter->get_friendly_name()] = pshape;
+            upperBoundShapes[parameter->get_friendly_name()] = upperBound;
+        }
+        if (!dynamicInputs.empty()) {
+            if (conf.enableDynamicBatch) {
+                IE_THROW(NotImplemented) << "Dynamic batch can't be used with the network which has dynamic input shapes";
+            }
+            if (!function->get_sinks().empty()) {
+                IE_THROW(NotImplemented) << "The network with dynamic input shapes can't have states";
+            }
+            // the shape subgraphs are folded into constants for the upper bounds, so they can't follow the input shapes
+            for (const auto& op : function->get_ordered_ops()) {
+                if ((ngraph::is_type<ngraph::op::v0::ShapeOf>(op) || ngraph::is_type<ngraph::op::v3::ShapeOf>(op)) &&
+                    op->get_input_partial_shape(0).is_dynamic()) {
+                    IE_THROW(NotImplemented) << "The network with dynamic input shapes can't compute shapes of the dynamic tensors, "
+                                             << "ShapeOf operation '" << op->get_friendly_name() << "' is not supported";
+                }
+            }
+            for (const auto& result : function->get_results()) {
+                if (result->get_input_partial_shape(0).is_dynamic())
+                    dynamicOutputs.insert(ngraph::op::util::create_ie_output_name(result->input_value(0)));
+            }
+        }
+    }
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
-    Transformation(clonedNetwork, conf);
+    if (!dynamicInputs.empty()) {
+        clonedNetwork.reshape(upperBoundShapes);
+    }
+
+    // The snippets are compiled for the static shapes only and can't be reshaped, so the operations are executed
+    // by the nodes of their own
+    Transformation(clonedNetwork, conf, dynamicInputs.empty());
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    if (!dynamicInputs.empty()) {
+        execNetwork->setDynamicShapes(dynamicInputs, dynamicOutputs);
+    }
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    MKLDNNKernelCache::getInstance().setCapacity(engConfig.kernelCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -450,6 +535,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -496,6 +582,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -505,6 +593,48 @@ void Engine::AddExtension(const InferenceEngine::IExtensionPtr& extension) {
     extensionManager->AddExtension(extension);
 }
 
+std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+Engine::ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "ImportNetwork");
+
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& extensions) {
+            return GetCore()->ReadNetwork(model, weights, extensions);
+        });
+
+    // The blob keeps the network after the plugin transformations, so it is compiled as is
+    ExportedNetwork exported;
+    deserializer >> exported;
+    auto& network = exported.network;
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+
+    // The snippets are exported as the original operations, the networks with dynamic input shapes don't use them
+    if (exported.dynamicInputs.empty() && !conf.enforceBF16 && with_cpu_x86_avx2()) {
+        TokenizeSnippets(network.getFunction());
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager, weightsSharing, exported.plan);
+    if (!exported.dynamicInputs.empty()) {
+        execNetwork->setDynamicShapes(exported.dynamicInputs, exported.dynamicOutputs);
+    }
+
+    ConstInputsDataMap inputs;
+    for (const auto& input : network.getInputsInfo())
+        inputs.emplace(input.first, input.second);
+    ConstOutputsDataMap outputs;
+    for (const auto& output : network.getOutputsInfo())
+        outputs.emplace(output.first, output.second);
+    SetExeNetworkInfo(execNetwork, inputs, outputs);
+
+    return execNetwork;
+}
+
 QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::map<std::string, std::string>& config) const {
     QueryNetworkResult res;
 
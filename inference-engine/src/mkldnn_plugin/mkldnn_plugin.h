@@ -33,6 +33,9 @@ public:
 
     InferenceEngine::Parameter GetMetric(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
 
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> ImportNetwork(std::istream& networkModel,
+                                                                          const std::map<std::string, std::string>& config) override;
+
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                      const std::map<std::string, std::string>& config) const override;
 
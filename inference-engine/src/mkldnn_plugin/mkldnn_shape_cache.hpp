@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * LRU cache of the objects a node creates for the shapes it is reshaped to (primitives, JIT kernels), keyed by the dims
+ * of the node. The inputs of a network with dynamic shapes usually take few distinct shapes, so a node switching between
+ * them takes the objects from the cache instead of creating them again.
+ *
+ * Is not thread safe, the graph owning the node is reshaped under the lock of its stream
+ */
+template <typename T>
+class MKLDNNShapeCache {
+public:
+    static constexpr std::size_t defaultCapacity = 16;
+
+    explicit MKLDNNShapeCache(std::size_t capacity = defaultCapacity) : capacity(capacity) {}
+
+    /**
+     * Returns true and the cached value if there is the key, the entry becomes the most recently used one
+     */
+    bool find(const std::string& key, T& value) {
+        auto found = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) { return entry.first == key; });
+        if (found == entries.end())
+            return false;
+        entries.splice(entries.begin(), entries, found);
+        value = found->second;
+        return true;
+    }
+
+    void put(const std::string& key, const T& value) {
+        auto found = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) { return entry.first == key; });
+        if (found != entries.end()) {
+            found->second = value;
+            entries.splice(entries.begin(), entries, found);
+            return;
+        }
+        entries.emplace_front(key, value);
+        while (entries.size() > capacity)
+            entries.pop_back();
+    }
+
+    std::size_t size() const { return entries.size(); }
+
+private:
+    using Entry = std::pair<std::string, T>;
+
+    std::size_t capacity;
+    // The most recently used entries are at the front
+    std::list<Entry> entries;
+};
+
+template <typename T>
+constexpr std::size_t MKLDNNShapeCache<T>::defaultCapacity;
+
+}  // namespace MKLDNNPlugin
@@ -5,11 +5,153 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include "ie_parallel.hpp"
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t hashRound(uint64_t acc, uint64_t input) {
+    acc += input * kPrime2;
+    acc = rotl(acc, 31);
+    return acc * kPrime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= hashRound(0, val);
+    return acc * kPrime1 + kPrime4;
+}
+
+// xxHash64, processes 32 bytes per iteration in four independent lanes
+uint64_t xxHash64(const unsigned char* data, size_t size, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* const end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const unsigned char* const limit = end - 32;
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+        do {
+            v1 = hashRound(v1, read64(p));
+            v2 = hashRound(v2, read64(p + 8));
+            v3 = hashRound(v3, read64(p + 16));
+            v4 = hashRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + kPrime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= hashRound(0, read64(p));
+        h = rotl(h, 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * kPrime1;
+        h = rotl(h, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * kPrime5;
+        h = rotl(h, 11) * kPrime1;
+    }
+
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size, uint64_t seed) const {
+    if (size <= kChunkSize)
+        return xxHash64(data, size, seed);
+
+    const size_t chunksCount = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksCount);
+    InferenceEngine::parallel_for(chunksCount, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = xxHash64(data + offset, std::min(kChunkSize, size - offset), seed + i);
+    });
+    return xxHash64(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                    chunksCount * sizeof(uint64_t), seed ^ static_cast<uint64_t>(size));
+}
+
+const SimpleDataHash MKLDNNWeightsSharing::dataHash;
+
+std::string MKLDNNWeightsSharing::GetContentKey(const void* data, size_t size,
+                                                const InferenceEngine::TensorDesc& srcDesc,
+                                                const mkldnn::memory::desc& dstDesc) {
+    std::string key = std::to_string(size) + "_" + std::to_string(dataHash.hash(static_cast<const unsigned char*>(data), size));
+
+    const auto& srcBlocking = srcDesc.getBlockingDesc();
+    key += "_" + std::string(srcDesc.getPrecision().name()) + "_" + std::to_string(srcBlocking.getOffsetPadding());
+    for (auto dim : srcBlocking.getBlockDims())
+        key += "," + std::to_string(dim);
+    for (auto axis : srcBlocking.getOrder())
+        key += "," + std::to_string(axis);
+    for (auto stride : srcBlocking.getStrides())
+        key += "," + std::to_string(stride);
+
+    const auto& md = dstDesc.data;
+    key += "_" + std::to_string(md.data_type) + "_" + std::to_string(md.format_kind) + "_" + std::to_string(md.offset0);
+    for (int i = 0; i < md.ndims; i++)
+        key += "," + std::to_string(md.dims[i]) + ":" + std::to_string(md.padded_dims[i]) + ":" + std::to_string(md.padded_offsets[i]);
+    if (md.format_kind == mkldnn_blocked) {
+        const auto& blocking = md.format_desc.blocking;
+        for (int i = 0; i < md.ndims; i++)
+            key += "," + std::to_string(blocking.strides[i]);
+        for (int i = 0; i < blocking.inner_nblks; i++)
+            key += "," + std::to_string(blocking.inner_idxs[i]) + ":" + std::to_string(blocking.inner_blks[i]);
+    }
+    key += "_" + std::to_string(md.extra.flags) + "_" + std::to_string(md.extra.compensation_mask)
+         + "_" + std::to_string(md.extra.scale_adjust);
+    return key;
+}
+
+uint64_t MKLDNNWeightsSharing::GetContentChecksum(const void* data, size_t size) {
+    return dataHash.hash(static_cast<const unsigned char*>(data), size, kPrime3);
+}
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -35,7 +177,8 @@ void MKLDNNWeightsSharing::MKLDNNSharedMemory::valid(bool b) {
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
-                            bool valid) {
+                            bool valid,
+                            uint64_t checksum) {
     std::unique_lock<std::mutex> lock(guard);
     auto found = sharedWeights.find(key);
 
@@ -45,8 +188,13 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
     if (found == sharedWeights.end()
         || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
         newPtr = create();
-        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
+        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid, checksum);
         sharedWeights[key] = ptr;
+    } else if (ptr->checksum != checksum) {
+        // the keys collided: the memory isn't shared and the stored one is kept for its users
+        lock.unlock();
+        newPtr = create();
+        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid, checksum);
     }
 
     return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
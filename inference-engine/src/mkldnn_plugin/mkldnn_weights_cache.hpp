@@ -24,26 +24,15 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    /**
+     * Computes 64-bit hash of the data. The buffer is split into fixed size chunks which are hashed
+     * in parallel with the xxHash64 algorithm, then the chunk hashes are combined in the order of the chunks,
+     * so the result doesn't depend on the number of threads. Hashes with different seeds are independent
+     */
+    uint64_t hash(const unsigned char* data, size_t size, uint64_t seed = 0) const;
 
 protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const size_t kChunkSize = 1 << 20;
 };
 
 /**
@@ -56,14 +45,16 @@ class MKLDNNWeightsSharing {
     struct MKLDNNMemoryInfo {
         typedef std::shared_ptr<MKLDNNMemoryInfo> Ptr;
 
-        MKLDNNMemoryInfo(MKLDNNMemoryPtr memoryPtr, bool valid)
+        MKLDNNMemoryInfo(MKLDNNMemoryPtr memoryPtr, bool valid, uint64_t checksum)
             : sharedMemory(memoryPtr)
             , valid(valid)
+            , checksum(checksum)
         {}
 
         std::mutex guard;
         std::weak_ptr<MKLDNNMemory> sharedMemory;
         std::atomic<bool> valid;
+        const uint64_t checksum;
     };
 
 public:
@@ -87,18 +78,39 @@ public:
         MKLDNNMemoryPtr newPtr;
     };
 
+    /**
+     * Returns the memory stored under the key or stores the created one.
+     * A found memory is shared only if it was stored with the same checksum, otherwise the keys collided
+     * and the created memory is returned without being stored
+     */
     MKLDNNSharedMemory::Ptr findOrCreate(const std::string& key,
                                          std::function<MKLDNNMemoryPtr(void)> create,
-                                         bool valid = true);
+                                         bool valid = true,
+                                         uint64_t checksum = 0);
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const SimpleDataHash& GetHashFunc () { return dataHash; }
+
+    /**
+     * Builds a content based key of the memory: the same data converted from the same source descriptor
+     * to the same destination descriptor gets the same key regardless of the network and the node it belongs to,
+     * so identical weights of different networks are stored once.
+     * The key is a hash, so it must be used together with the checksum of the data
+     */
+    static std::string GetContentKey(const void* data, size_t size,
+                                     const InferenceEngine::TensorDesc& srcDesc,
+                                     const mkldnn::memory::desc& dstDesc);
+
+    /**
+     * Hash of the data independent of the one in the content key, passed to findOrCreate to detect key collisions
+     */
+    static uint64_t GetContentChecksum(const void* data, size_t size);
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    static const SimpleDataHash dataHash;
 };
 
 /**
@@ -5,6 +5,7 @@
 #include <ngraph/pass/constant_folding.hpp>
 #include "convert_matmul_to_fc_or_gemm.hpp"
 #include "fc_bias_fusion.hpp"
+#include "fc_weights_decompression.hpp"
 #include "reshape_fc_fusion.hpp"
 #include "reshape_fully_connected.hpp"
 #include "convert_broadcast_to_tiles.hpp"
@@ -18,9 +19,10 @@
 
 namespace MKLDNNPlugin {
 
-inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
+// foldingThreads limits the threads of the constant folding, 0 means the number of the hardware threads
+inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc, size_t foldingThreads = 0) {
     ngraph::pass::Manager manager;
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(foldingThreads);
     manager.register_pass<Reshape1DConvolution>();
     manager.register_pass<Reshape1DGroupConvolution>();
     manager.register_pass<Reshape1DAvgPool>();
@@ -41,8 +43,12 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     if (!ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc)) {
         manager.register_pass<ReshapeFullyConnectedFusion>();
     }
-    manager.register_pass<ngraph::pass::ConstantFolding>();
-    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i64, ngraph::element::i32 }});
+    manager.register_pass<FullyConnectedWeightsDecompression>();
+    manager.register_pass<EnableWeightsDecompressionFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(foldingThreads);
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i64, ngraph::element::i32 },
+                                                                            { ngraph::element::i4, ngraph::element::i8 },
+                                                                            { ngraph::element::u4, ngraph::element::u8 }});
     manager.run_passes(nGraphFunc);
 }
 
@@ -0,0 +1,325 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_decompression.hpp"
+#include "op/fully_connected.hpp"
+#include <algorithm>
+#include <numeric>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+namespace {
+
+// Groups of weights with the same scale and zero point must not be smaller, otherwise the compressed weights
+// together with the decompression parameters don't save memory
+constexpr size_t minGroupSize = 8lu;
+
+bool is4Bit(const ngraph::element::Type& type) {
+    return type == ngraph::element::u4 || type == ngraph::element::i4;
+}
+
+size_t greatestCommonDivisor(size_t a, size_t b) {
+    while (b != 0) {
+        a %= b;
+        std::swap(a, b);
+    }
+    return a;
+}
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->output(0).get_target_inputs().size() == 1;
+}
+
+// Returns the Constant input of the Add, Subtract or Multiply operation which doesn't change the shape of the other input
+std::shared_ptr<ngraph::opset1::Constant> getDecompressionConstant(const std::shared_ptr<ngraph::Node>& node, size_t& dataPort) {
+    if (!ngraph::is_type<ngraph::opset1::Add>(node) && !ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+        !ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return nullptr;
+    if (!hasSingleConsumer(node) || !node->get_output_element_type(0).is_real())
+        return nullptr;
+
+    for (size_t port = 0; port < 2; port++) {
+        auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(port));
+        dataPort = 1 - port;
+        if (constant && node->get_input_partial_shape(dataPort).is_static() &&
+            node->get_input_shape(dataPort) == node->get_output_shape(0))
+            return constant;
+    }
+    return nullptr;
+}
+
+bool isLayoutOperation(const std::shared_ptr<ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::Transpose>(node))
+        return ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1));
+    return ngraph::is_type<ngraph::opset1::Reshape>(node) || ngraph::is_type<ngraph::opset1::Squeeze>(node) ||
+           ngraph::is_type<ngraph::opset1::Unsqueeze>(node);
+}
+
+// Walks down from the node through the decompression operations, returns the Convert of the 4-bit Constant or nullptr
+std::shared_ptr<ngraph::opset1::Convert> getDecompressionConvert(std::shared_ptr<ngraph::Node> node,
+                                                                 std::vector<std::shared_ptr<ngraph::Node>>& decompressionOps) {
+    size_t dataPort = 0;
+    while (getDecompressionConstant(node, dataPort)) {
+        decompressionOps.push_back(node);
+        node = node->get_input_node_shared_ptr(dataPort);
+    }
+
+    auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(node);
+    if (!convert || !hasSingleConsumer(convert) || !convert->get_output_element_type(0).is_real())
+        return nullptr;
+    auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+    if (!constant || !is4Bit(constant->get_output_element_type(0)))
+        return nullptr;
+    return convert;
+}
+
+// Broadcasts the Constant to the shape by numpy rules, returns an empty vector if the Constant is not broadcastable
+std::vector<float> broadcastConstant(const std::shared_ptr<ngraph::opset1::Constant>& constant, const ngraph::Shape& shape) {
+    const auto values = constant->cast_vector<float>();
+    auto constShape = constant->get_shape();
+    if (constShape.size() > shape.size()) {
+        const size_t extraDims = constShape.size() - shape.size();
+        if (std::any_of(constShape.begin(), constShape.begin() + extraDims, [](size_t dim) { return dim != 1; }))
+            return {};
+        constShape.erase(constShape.begin(), constShape.begin() + extraDims);
+    }
+    constShape.insert(constShape.begin(), shape.size() - constShape.size(), 1);
+
+    std::vector<size_t> constStrides(shape.size(), 0);
+    for (size_t i = shape.size(), stride = 1; i > 0; i--) {
+        if (constShape[i - 1] != 1 && constShape[i - 1] != shape[i - 1])
+            return {};
+        constStrides[i - 1] = constShape[i - 1] == 1 ? 0 : stride;
+        stride *= constShape[i - 1];
+    }
+
+    std::vector<float> result(ngraph::shape_size(shape));
+    std::vector<size_t> coord(shape.size(), 0);
+    for (auto& value : result) {
+        size_t offset = 0;
+        for (size_t i = 0; i < coord.size(); i++)
+            offset += coord[i] * constStrides[i];
+        value = values[offset];
+        for (size_t i = coord.size(); i > 0 && ++coord[i - 1] == shape[i - 1]; i--)
+            coord[i - 1] = 0;
+    }
+    return result;
+}
+
+std::vector<size_t> transposeIndices(const std::vector<size_t>& indices, const ngraph::Shape& shape, const std::vector<int64_t>& order) {
+    std::vector<size_t> strides(shape.size(), 1);
+    for (size_t i = shape.size(); i > 1; i--)
+        strides[i - 2] = strides[i - 1] * shape[i - 1];
+
+    ngraph::Shape transposedShape(shape.size());
+    for (size_t i = 0; i < order.size(); i++)
+        transposedShape[i] = shape[order[i]];
+
+    std::vector<size_t> result(indices.size());
+    std::vector<size_t> coord(shape.size(), 0);
+    for (auto& index : result) {
+        size_t offset = 0;
+        for (size_t i = 0; i < coord.size(); i++)
+            offset += coord[i] * strides[order[i]];
+        index = indices[offset];
+        for (size_t i = coord.size(); i > 0 && ++coord[i - 1] == transposedShape[i - 1]; i--)
+            coord[i - 1] = 0;
+    }
+    return result;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::is4BitWeightsDecompression(const std::shared_ptr<ngraph::Node>& node) {
+    std::vector<std::shared_ptr<ngraph::Node>> decompressionOps;
+    return getDecompressionConvert(node, decompressionOps) != nullptr;
+}
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::DisableFCWeightsDecompressionFolding, "DisableFCWeightsDecompressionFolding", 0);
+
+MKLDNNPlugin::DisableFCWeightsDecompressionFolding::DisableFCWeightsDecompressionFolding() {
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(), ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto matmul = m.get_match_root();
+        // The same inputs as ConvertMatMulToFC expects: the weights are the second input and the data is not constant
+        if (ngraph::is_type<ngraph::opset1::Constant>(matmul->get_input_node_ptr(0)))
+            return false;
+
+        std::vector<std::shared_ptr<ngraph::Node>> decompressionOps;
+        auto convert = getDecompressionConvert(matmul->get_input_node_shared_ptr(1), decompressionOps);
+        if (!convert)
+            return false;
+
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "DisableFCWeightsDecompressionFolding");
+    this->register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FullyConnectedWeightsDecompression, "FullyConnectedWeightsDecompression", 0);
+
+MKLDNNPlugin::FullyConnectedWeightsDecompression::FullyConnectedWeightsDecompression() {
+    auto m_fc = ngraph::pattern::wrap_type<MKLDNNPlugin::FullyConnectedNode>(ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto fc = std::dynamic_pointer_cast<MKLDNNPlugin::FullyConnectedNode>(m.get_match_root());
+        if (!fc || fc->get_input_size() > 3 || fc->get_input_element_type(0) != ngraph::element::f32 ||
+            fc->get_input_element_type(1) != ngraph::element::f32 || fc->get_input_partial_shape(0).is_dynamic())
+            return false;
+
+        std::vector<std::shared_ptr<ngraph::Node>> layoutOps;
+        auto node = fc->get_input_node_shared_ptr(1);
+        while (isLayoutOperation(node) && hasSingleConsumer(node)) {
+            layoutOps.push_back(node);
+            node = node->get_input_node_shared_ptr(0);
+        }
+
+        std::vector<std::shared_ptr<ngraph::Node>> decompressionOps;
+        auto convert = getDecompressionConvert(node, decompressionOps);
+        if (!convert)
+            return false;
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+
+        // The decompressed weight is rawValues[i] * scales[i] + shifts[i], the signed values are stored with +8 offset
+        const auto& shape = constant->get_shape();
+        const size_t elementsNum = ngraph::shape_size(shape);
+        const bool isSigned = constant->get_output_element_type(0) == ngraph::element::i4;
+        std::vector<uint8_t> rawValues(elementsNum);
+        {
+            const auto values = constant->cast_vector<int>();
+            std::transform(values.begin(), values.end(), rawValues.begin(), [&](int value) {
+                return static_cast<uint8_t>(isSigned ? value + 8 : value);
+            });
+        }
+        std::vector<float> scales(elementsNum, 1.f), shifts(elementsNum, isSigned ? -8.f : 0.f);
+        for (auto op = decompressionOps.rbegin(); op != decompressionOps.rend(); op++) {
+            size_t dataPort = 0;
+            const auto values = broadcastConstant(getDecompressionConstant(*op, dataPort), shape);
+            if (values.empty())
+                return false;
+            for (size_t i = 0; i < elementsNum; i++) {
+                if (ngraph::is_type<ngraph::opset1::Multiply>(*op)) {
+                    scales[i] *= values[i];
+                    shifts[i] *= values[i];
+                } else if (ngraph::is_type<ngraph::opset1::Add>(*op)) {
+                    shifts[i] += values[i];
+                } else if (dataPort == 0) {
+                    shifts[i] -= values[i];
+                } else {
+                    scales[i] = -scales[i];
+                    shifts[i] = values[i] - shifts[i];
+                }
+            }
+        }
+
+        // indices[i] is the index of the original element which is the i-th element of the FullyConnected weights
+        std::vector<size_t> indices(elementsNum);
+        std::iota(indices.begin(), indices.end(), 0lu);
+        ngraph::Shape weightsShape = shape;
+        for (auto op = layoutOps.rbegin(); op != layoutOps.rend(); op++) {
+            if (ngraph::is_type<ngraph::opset1::Transpose>(*op)) {
+                const auto order = std::dynamic_pointer_cast<ngraph::opset1::Constant>((*op)->get_input_node_shared_ptr(1))->cast_vector<int64_t>();
+                if (order.size() != weightsShape.size())
+                    return false;
+                indices = transposeIndices(indices, weightsShape, order);
+            }
+            weightsShape = (*op)->get_output_shape(0);
+        }
+
+        const auto& dataShape = fc->get_input_shape(0);
+        const size_t N = fc->get_shape().back();
+        const size_t K = dataShape.size() == 3 ? dataShape[2] :
+                         std::accumulate(dataShape.begin() + 1, dataShape.end(), size_t{1}, std::multiplies<size_t>());
+        if (weightsShape.empty() || weightsShape[0] != N || N * K != elementsNum)
+            return false;
+
+        std::vector<float> zeroPoints(elementsNum, 0.f);
+        for (size_t i = 0; i < elementsNum; i++) {
+            if (scales[i] != 0.f)
+                zeroPoints[i] = -shifts[i] / scales[i];
+            else if (shifts[i] != 0.f)
+                return false;
+        }
+
+        // The group size is the largest divisor of K such that the decompression parameters are the same inside every group
+        size_t groupSize = K;
+        for (size_t n = 0; n < N && groupSize >= minGroupSize; n++) {
+            for (size_t k = 1; k < K; k++) {
+                const size_t prev = indices[n * K + k - 1], curr = indices[n * K + k];
+                if (scales[prev] != scales[curr] || zeroPoints[prev] != zeroPoints[curr])
+                    groupSize = greatestCommonDivisor(groupSize, k);
+            }
+        }
+        if (groupSize < minGroupSize)
+            return false;
+
+        const size_t groupsNum = K / groupSize;
+        const size_t rowStride = (K + 1) / 2;
+        std::vector<uint8_t> packedWeights(N * rowStride, 0);
+        std::vector<float> groupScales(N * groupsNum), groupZeroPoints(N * groupsNum);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t k = 0; k < K; k++) {
+                packedWeights[n * rowStride + k / 2] |= rawValues[indices[n * K + k]] << ((k % 2) * 4);
+            }
+            for (size_t g = 0; g < groupsNum; g++) {
+                const size_t index = indices[n * K + g * groupSize];
+                groupScales[n * groupsNum + g] = scales[index];
+                groupZeroPoints[n * groupsNum + g] = zeroPoints[index];
+            }
+        }
+
+        ngraph::NodeVector new_ops;
+        auto weights = std::make_shared<ngraph::opset1::Constant>(ngraph::element::u8, ngraph::Shape{N, rowStride}, packedWeights);
+        auto scalesConst = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, ngraph::Shape{N, groupsNum}, groupScales);
+        auto zeroPointsConst = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, ngraph::Shape{N, groupsNum}, groupZeroPoints);
+        new_ops.insert(new_ops.end(), {weights, scalesConst, zeroPointsConst});
+
+        ngraph::Output<ngraph::Node> bias;
+        if (fc->get_input_size() == 3) {
+            bias = fc->input_value(2);
+        } else {
+            bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{N}, std::vector<float>(N, 0.f));
+            new_ops.push_back(bias.get_node_shared_ptr());
+        }
+
+        auto new_fc = std::make_shared<MKLDNNPlugin::FullyConnectedNode>(fc->input_value(0), weights, bias, scalesConst, zeroPointsConst,
+                                                                         fc->get_shape(), fc->get_output_type());
+        new_fc->set_friendly_name(fc->get_friendly_name());
+        new_ops.push_back(new_fc);
+
+        ngraph::NodeVector fused_ops = {fc, convert, constant};
+        fused_ops.insert(fused_ops.end(), layoutOps.begin(), layoutOps.end());
+        fused_ops.insert(fused_ops.end(), decompressionOps.begin(), decompressionOps.end());
+        ngraph::copy_runtime_info(fused_ops, new_ops);
+        ngraph::replace_node(fc, new_fc);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_fc, "FullyConnectedWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::EnableWeightsDecompressionFolding, "EnableWeightsDecompressionFolding", 0);
+
+MKLDNNPlugin::EnableWeightsDecompressionFolding::EnableWeightsDecompressionFolding() {
+    auto m_convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ngraph::pattern::wrap_type<ngraph::opset1::Constant>()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto convert = m.get_match_root();
+        auto& rtInfo = convert->get_rt_info();
+        if (!is4Bit(convert->get_input_element_type(0)) || !rtInfo.count("DISABLED_CONSTANT_FOLDING"))
+            return false;
+
+        rtInfo.erase("DISABLED_CONSTANT_FOLDING");
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_convert, "EnableWeightsDecompressionFolding");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+/*
+ * Description:
+ *     FullyConnectedWeightsDecompression transformation detects FullyConnected operations which weights
+ *     are decompressed from a 4-bit Constant:
+ *
+ *         Constant(u4/i4) -> Convert -> [Subtract/Add/Multiply by Constants] -> [Reshape/Transpose] -> FullyConnected
+ *
+ *     and replaces them with FullyConnected which takes the packed 4-bit weights together with
+ *     the scales and zero points of the weights groups, so the weights stay compressed in memory.
+ *
+ *     DisableFCWeightsDecompressionFolding keeps such decompression subgraphs unfolded when they are the weights
+ *     of MatMul, so they survive the common constant folding until MatMul is converted to FullyConnected.
+ *
+ *     EnableWeightsDecompressionFolding allows constant folding of the 4-bit decompression subgraphs
+ *     which are not fused into FullyConnected.
+ */
+
+namespace MKLDNNPlugin {
+
+bool is4BitWeightsDecompression(const std::shared_ptr<ngraph::Node>& node);
+
+class DisableFCWeightsDecompressionFolding: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DisableFCWeightsDecompressionFolding();
+};
+
+class FullyConnectedWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FullyConnectedWeightsDecompression();
+};
+
+class EnableWeightsDecompressionFolding: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EnableWeightsDecompressionFolding();
+};
+
+}  // namespace MKLDNNPlugin
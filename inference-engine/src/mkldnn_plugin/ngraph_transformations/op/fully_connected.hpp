@@ -29,6 +29,16 @@ public:
                        const ngraph::Shape &output_shape,
                        const ngraph::element::Type output_type = ngraph::element::undefined);
 
+    // FullyConnected with 4-bit weights: B holds two weights per byte (the even input channel in the low nibble),
+    // D and E are the scales and the zero points of the weights groups with shape [output channels, groups number]
+    FullyConnectedNode(const ngraph::Output<Node> &A,
+                       const ngraph::Output<Node> &B,
+                       const ngraph::Output<Node> &C,
+                       const ngraph::Output<Node> &D,
+                       const ngraph::Output<Node> &E,
+                       const ngraph::Shape &output_shape,
+                       const ngraph::element::Type output_type = ngraph::element::undefined);
+
     bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
 
     void validate_and_infer_types() override;
@@ -14,6 +14,8 @@ public:
     static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
     const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
 
+    PowerStaticNode() = default;
+
     PowerStaticNode(const ngraph::Output<ngraph::Node> &data, const float &power, const float &scale, const float &shift,
                     const ngraph::element::Type output_type = ngraph::element::undefined);
 
@@ -28,7 +30,7 @@ public:
     float get_shift() const { return shift; }
 
 private:
-    float scale, power, shift;
+    float scale = 1.f, power = 1.f, shift = 0.f;
     ngraph::element::Type m_output_type;
 };
 
@@ -14,6 +14,8 @@ public:
     static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
     const ngraph::NodeTypeInfo &get_type_info() const override { return type_info; }
 
+    SwishNode() = default;
+
     explicit SwishNode(const ngraph::Output<Node> &input, float alpha = 1.0);
 
     void validate_and_infer_types() override;
@@ -22,7 +24,7 @@ public:
 
     float get_alpha() const;
 protected:
-    float m_alpha;
+    float m_alpha = 1.0f;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,60 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets_mark_skipped.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include "op/fully_connected.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::SnippetsMarkSkipped, "SnippetsMarkSkipped", 0);
+
+namespace {
+
+bool isFusingTarget(const std::shared_ptr<ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+           ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+           ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+           ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node) ||
+           ngraph::is_type<ngraph::opset1::BinaryConvolution>(node) ||
+           ngraph::is_type<ngraph::opset1::MatMul>(node) ||
+           ngraph::is_type<MKLDNNPlugin::FullyConnectedNode>(node) ||
+           ngraph::is_type<ngraph::opset6::MVN>(node) ||
+           ngraph::is_type<ngraph::opset1::NormalizeL2>(node) ||
+           ngraph::is_type<ngraph::opset4::Interpolate>(node);
+}
+
+bool isElementwise(const std::shared_ptr<ngraph::Node>& node) {
+    return ngraph::op::is_unary_elementwise_arithmetic(node) ||
+           ngraph::is_type<ngraph::opset1::Clamp>(node) ||
+           ngraph::is_type<ngraph::opset1::Elu>(node) ||
+           ngraph::is_type<ngraph::opset1::PRelu>(node) ||
+           ngraph::op::is_binary_elementwise_arithmetic(node) ||
+           ngraph::op::is_binary_elementwise_comparison(node) ||
+           ngraph::op::is_binary_elementwise_logical(node);
+}
+
+} // namespace
+
+bool MKLDNNPlugin::SnippetsMarkSkipped::run_on_function(std::shared_ptr<ngraph::Function> function) {
+    // ops are visited in topological order, so the whole chain of elementwise ops after a fusing target is marked
+    for (const auto& node : function->get_ordered_ops()) {
+        if (!isElementwise(node))
+            continue;
+
+        for (const auto& input : node->input_values()) {
+            const auto parent = input.get_node_shared_ptr();
+            if (input.get_target_inputs().size() != 1 || parent->get_output_size() != 1)
+                continue;
+            if (isFusingTarget(parent) || ngraph::snippets::pass::IsSkippedByPlugin(parent)) {
+                ngraph::snippets::pass::SetSkippedByPlugin(node);
+                break;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Marks the elementwise operations which are going to be fused by the plugin into the preceding
+ * convolution/matmul/etc. nodes, so the snippets tokenizer leaves them as is
+ */
+class SnippetsMarkSkipped : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_u4_weights.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Number of weights rows which are decompressed together and multiplied by the same source row
+constexpr size_t rowsBlock = 4lu;
+// Number of independent partial sums per row, the partial sums are accumulated in vector registers
+constexpr size_t simdWidth = 16lu;
+
+void decompressRow(const uint8_t *weights, const float *scales, const float *zeroPoints, float *row, size_t K, size_t groupSize) {
+    for (size_t groupBegin = 0, g = 0; groupBegin < K; groupBegin += groupSize, g++) {
+        const size_t groupEnd = (std::min)(groupBegin + groupSize, K);
+        const float scale = scales[g];
+        const float zeroPoint = zeroPoints[g];
+        for (size_t k = groupBegin; k < groupEnd; k++) {
+            const uint8_t value = (weights[k / 2] >> ((k % 2) * 4)) & 0x0F;
+            row[k] = (static_cast<float>(value) - zeroPoint) * scale;
+        }
+    }
+}
+
+template <size_t rowsNum>
+void dotRows(const float *src, const float *rows, float *dst, size_t K) {
+    float acc[rowsNum][simdWidth] = {};
+    const size_t tailBegin = K - K % simdWidth;
+    for (size_t k = 0; k < tailBegin; k += simdWidth) {
+        for (size_t r = 0; r < rowsNum; r++) {
+            for (size_t i = 0; i < simdWidth; i++) {
+                acc[r][i] += src[k + i] * rows[r * K + k + i];
+            }
+        }
+    }
+    for (size_t r = 0; r < rowsNum; r++) {
+        float sum = 0.f;
+        for (size_t i = 0; i < simdWidth; i++)
+            sum += acc[r][i];
+        for (size_t k = tailBegin; k < K; k++)
+            sum += src[k] * rows[r * K + k];
+        dst[r] = sum;
+    }
+}
+
+}  // namespace
+
+void fc_u4_weights(const float *src, const uint8_t *weights, const float *scales, const float *zeroPoints, const float *bias,
+                   float *dst, size_t M, size_t N, size_t K, size_t groupSize) {
+    const size_t rowStride = (K + 1) / 2;
+    const size_t groupsNum = (K + groupSize - 1) / groupSize;
+    const size_t blocksNum = (N + rowsBlock - 1) / rowsBlock;
+
+    // Every block of the weights rows is read from memory and decompressed only once, the source is small enough
+    // to stay in cache when the weights traffic matters, i.e. for a few source rows
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocksNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> rows(rowsBlock * K);
+        float sums[rowsBlock];
+        for (size_t block = start; block < end; block++) {
+            const size_t n0 = block * rowsBlock;
+            const size_t rowsNum = (std::min)(rowsBlock, N - n0);
+            for (size_t r = 0; r < rowsNum; r++) {
+                decompressRow(weights + (n0 + r) * rowStride, scales + (n0 + r) * groupsNum, zeroPoints + (n0 + r) * groupsNum,
+                              &rows[r * K], K, groupSize);
+            }
+
+            for (size_t m = 0; m < M; m++) {
+                if (rowsNum == rowsBlock) {
+                    dotRows<rowsBlock>(src + m * K, rows.data(), sums, K);
+                } else {
+                    for (size_t r = 0; r < rowsNum; r++)
+                        dotRows<1>(src + m * K, &rows[r * K], &sums[r], K);
+                }
+                for (size_t r = 0; r < rowsNum; r++)
+                    dst[m * N + n0 + r] = sums[r] + (bias ? bias[n0 + r] : 0.f);
+            }
+        }
+    });
+}
+
+void decompress_u4_weights(const uint8_t *weights, const float *scales, const float *zeroPoints, float *dst,
+                           size_t N, size_t K, size_t groupSize) {
+    const size_t rowStride = (K + 1) / 2;
+    const size_t groupsNum = (K + groupSize - 1) / groupSize;
+    parallel_for(N, [&](size_t n) {
+        decompressRow(weights + n * rowStride, scales + n * groupsNum, zeroPoints + n * groupsNum, dst + n * K, K, groupSize);
+    });
+}
+
+}  // namespace MKLDNNPlugin
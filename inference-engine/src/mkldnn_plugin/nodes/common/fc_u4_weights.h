@@ -0,0 +1,35 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Computes dst[M, N] = src[M, K] * W[N, K]^T + bias[N], where the weights W are stored as 4-bit unsigned values
+ * and decompressed on the fly: W[n, k] = (weights[n, k] - zeroPoints[n, g]) * scales[n, g], g = k / groupSize.
+ * Two weights are packed into one byte, the element with the even k is stored in the low nibble.
+ * Every row of the weights starts from a new byte, so a row takes (K + 1) / 2 bytes.
+ * @param bias may be nullptr
+ */
+void fc_u4_weights(const float *src, const uint8_t *weights, const float *scales, const float *zeroPoints, const float *bias,
+                   float *dst, size_t M, size_t N, size_t K, size_t groupSize);
+
+/**
+ * @brief The maximal number of the source rows M for which fc_u4_weights is used. The kernel decompresses the weights on every
+ * call and doesn't block the rows of the source, so it wins only while the weights traffic dominates. For more rows
+ * the weights are decompressed once by decompress_u4_weights and multiplied by the oneDNN sgemm
+ */
+constexpr size_t fc_u4_weights_max_rows = 8lu;
+
+/**
+ * @brief Decompresses the 4-bit weights packed as described for fc_u4_weights into dst[N, K]
+ */
+void decompress_u4_weights(const uint8_t *weights, const float *scales, const float *zeroPoints, float *dst,
+                           size_t N, size_t K, size_t groupSize);
+
+}  // namespace MKLDNNPlugin
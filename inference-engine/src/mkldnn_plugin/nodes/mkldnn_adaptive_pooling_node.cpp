@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_adaptive_pooling_node.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset8.hpp>
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNAdaptivePoolingNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ngraph::is_type<ngraph::opset8::AdaptiveAvgPool>(op) && !ngraph::is_type<ngraph::opset8::AdaptiveMaxPool>(op)) {
+            errorMessage = "Only opset8 AdaptiveAvgPool and AdaptiveMaxPool operations are supported";
+            return false;
+        }
+        const auto rank = op->get_input_partial_shape(DATA_ID).rank();
+        if (rank.is_dynamic() || rank.get_length() < 3 || rank.get_length() > 5) {
+            errorMessage = "Supports only 3D, 4D and 5D input tensors";
+            return false;
+        }
+        if (op->get_input_partial_shape(DATA_ID).is_dynamic() || op->get_output_partial_shape(OUTPUT_ID).is_dynamic()) {
+            errorMessage = "Doesn't support dynamic shapes";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNAdaptivePoolingNode::MKLDNNAdaptivePoolingNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                     MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = std::string(op->get_type_name()) + " node with name '" + op->get_friendly_name() + "' ";
+    algorithm = ngraph::is_type<ngraph::opset8::AdaptiveMaxPool>(op) ? AdaptivePoolingMax : AdaptivePoolingAvg;
+
+    const size_t outputsNumber = algorithm == AdaptivePoolingMax ? 2 : 1;
+    if (getOriginalInputsNumber() != 2 || getOriginalOutputsNumber() != outputsNumber) {
+        IE_THROW() << errorPrefix << "has incorrect number of input/output edges!";
+    }
+
+    const auto& srcDims = op->get_input_shape(DATA_ID);
+    const auto& dstDims = op->get_output_shape(OUTPUT_ID);
+    N = srcDims[0];
+    C = srcDims[1];
+    const size_t spatialRank = srcDims.size() - 2;
+    size_t* inSpatial[] = {&ID, &IH, &IW};
+    size_t* outSpatial[] = {&OD, &OH, &OW};
+    for (size_t i = 0; i < spatialRank; i++) {
+        *inSpatial[3 - spatialRank + i] = srcDims[2 + i];
+        *outSpatial[3 - spatialRank + i] = dstDims[2 + i];
+    }
+    if (OD == 0 || OH == 0 || OW == 0 || ID == 0 || IH == 0 || IW == 0) {
+        IE_THROW() << errorPrefix << "has empty input or output spatial dimensions";
+    }
+}
+
+void MKLDNNAdaptivePoolingNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<DataConfigurator> outDataConf{{TensorDescCreatorTypes::ncsp, Precision::FP32}};
+    if (algorithm == AdaptivePoolingMax)
+        outDataConf.emplace_back(TensorDescCreatorTypes::ncsp, Precision::I32);
+
+    addSupportedPrimDesc({{TensorDescCreatorTypes::ncsp, Precision::FP32},
+                          {TensorDescCreatorTypes::ncsp, Precision::I32}},
+                         outDataConf,
+                         impl_desc_type::ref_any);
+}
+
+MKLDNNAdaptivePoolingNode::Windows MKLDNNAdaptivePoolingNode::makeWindows(size_t inSize, size_t outSize) {
+    Windows windows(outSize);
+    for (size_t i = 0; i < outSize; i++) {
+        windows[i].first = i * inSize / outSize;
+        windows[i].second = (i * inSize + inSize + outSize - 1) / outSize;
+    }
+    return windows;
+}
+
+void MKLDNNAdaptivePoolingNode::createPrimitive() {
+    windowsD = makeWindows(ID, OD);
+    windowsH = makeWindows(IH, OH);
+    windowsW = makeWindows(IW, OW);
+}
+
+void MKLDNNAdaptivePoolingNode::execute(mkldnn::stream strm) {
+    const auto *src = reinterpret_cast<const float *>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    auto *dst = reinterpret_cast<float *>(getChildEdgesAtPort(OUTPUT_ID)[0]->getMemoryPtr()->GetPtr());
+
+    if (algorithm == AdaptivePoolingAvg) {
+        executeAvg(src, dst);
+    } else {
+        int32_t *indices = nullptr;
+        if (outDims.size() > INDICES_ID) {
+            const auto indicesEdges = getChildEdgesAtPort(INDICES_ID);
+            if (!indicesEdges.empty())
+                indices = reinterpret_cast<int32_t *>(indicesEdges[0]->getMemoryPtr()->GetPtr());
+        }
+        executeMax(src, dst, indices);
+    }
+}
+
+void MKLDNNAdaptivePoolingNode::executeAvg(const float* src, float* dst) const {
+    const size_t srcChannelSize = ID * IH * IW;
+    const size_t dstChannelSize = OD * OH * OW;
+    // every iteration produces one row of the output
+    parallel_for3d(N * C, OD, OH, [&](size_t nc, size_t od, size_t oh) {
+        const float *srcChannel = src + nc * srcChannelSize;
+        float *dstRow = dst + nc * dstChannelSize + (od * OH + oh) * OW;
+        const auto &wd = windowsD[od];
+        const auto &wh = windowsH[oh];
+        for (size_t ow = 0; ow < OW; ow++) {
+            const auto &ww = windowsW[ow];
+            float sum = 0.f;
+            for (size_t id = wd.first; id < wd.second; id++) {
+                for (size_t ih = wh.first; ih < wh.second; ih++) {
+                    const float *srcRow = srcChannel + (id * IH + ih) * IW;
+                    for (size_t iw = ww.first; iw < ww.second; iw++) {
+                        sum += srcRow[iw];
+                    }
+                }
+            }
+            const size_t count = (wd.second - wd.first) * (wh.second - wh.first) * (ww.second - ww.first);
+            dstRow[ow] = sum / count;
+        }
+    });
+}
+
+void MKLDNNAdaptivePoolingNode::executeMax(const float* src, float* dst, int32_t* indices) const {
+    const size_t srcChannelSize = ID * IH * IW;
+    const size_t dstChannelSize = OD * OH * OW;
+    parallel_for3d(N * C, OD, OH, [&](size_t nc, size_t od, size_t oh) {
+        const float *srcChannel = src + nc * srcChannelSize;
+        const size_t dstOffset = nc * dstChannelSize + (od * OH + oh) * OW;
+        const auto &wd = windowsD[od];
+        const auto &wh = windowsH[oh];
+        for (size_t ow = 0; ow < OW; ow++) {
+            const auto &ww = windowsW[ow];
+            // the first maximum in the window order is selected, as in the reference implementation
+            size_t maxIdx = (wd.first * IH + wh.first) * IW + ww.first;
+            float maxVal = srcChannel[maxIdx];
+            for (size_t id = wd.first; id < wd.second; id++) {
+                for (size_t ih = wh.first; ih < wh.second; ih++) {
+                    const size_t rowOffset = (id * IH + ih) * IW;
+                    for (size_t iw = ww.first; iw < ww.second; iw++) {
+                        if (srcChannel[rowOffset + iw] > maxVal) {
+                            maxVal = srcChannel[rowOffset + iw];
+                            maxIdx = rowOffset + iw;
+                        }
+                    }
+                }
+            }
+            dst[dstOffset + ow] = maxVal;
+            if (indices)
+                indices[dstOffset + ow] = static_cast<int32_t>(maxIdx);
+        }
+    });
+}
+
+bool MKLDNNAdaptivePoolingNode::created() const {
+    return getType() == AdaptivePooling;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNAdaptivePoolingNode, AdaptivePooling);
@@ -0,0 +1,49 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNAdaptivePoolingNode : public MKLDNNNode {
+public:
+    MKLDNNAdaptivePoolingNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // [start, end) input coordinates of the windows along one spatial axis
+    using Windows = std::vector<std::pair<size_t, size_t>>;
+    static Windows makeWindows(size_t inSize, size_t outSize);
+
+    void executeAvg(const float* src, float* dst) const;
+    void executeMax(const float* src, float* dst, int32_t* indices) const;
+
+    // spatial dimensions are aligned to the 3D case, the missing leading ones are equal to 1
+    size_t N = 1, C = 1;
+    size_t ID = 1, IH = 1, IW = 1;
+    size_t OD = 1, OH = 1, OW = 1;
+    Windows windowsD, windowsH, windowsW;
+
+    std::string errorPrefix;
+
+    static const size_t DATA_ID = 0;
+    static const size_t POOLED_SHAPE_ID = 1;
+    static const size_t OUTPUT_ID = 0;
+    static const size_t INDICES_ID = 1;
+};
+
+}  // namespace MKLDNNPlugin
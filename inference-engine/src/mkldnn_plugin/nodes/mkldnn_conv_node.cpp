@@ -12,6 +12,8 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include <string>
 #include <vector>
+#include <numeric>
+#include <functional>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <utils/general_utils.h>
@@ -75,6 +77,7 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const std::shared_ptr<ngraph::Node>
         }
         paddingL = convolutionOp->get_pads_begin();
         paddingR = convolutionOp->get_pads_end();
+        autoPadding = convolutionOp->get_auto_pad() == ngraph::op::PadType::SAME_UPPER || convolutionOp->get_auto_pad() == ngraph::op::PadType::SAME_LOWER;
     } else if (groupConvolutionOp) {
         algorithm = ConvolutionGrouped;
 
@@ -97,6 +100,7 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const std::shared_ptr<ngraph::Node>
         }
         paddingL = groupConvolutionOp->get_pads_begin();
         paddingR = groupConvolutionOp->get_pads_end();
+        autoPadding = groupConvolutionOp->get_auto_pad() == ngraph::op::PadType::SAME_UPPER || groupConvolutionOp->get_auto_pad() == ngraph::op::PadType::SAME_LOWER;
     }
 }
 
@@ -481,17 +485,17 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
 
 
 void MKLDNNConvolutionNode::createPrimitive() {
-    if (prim)
-        return;
-
-    mkldnn::primitive_attr attr;
-    addZeroPoints(attr);
-    setPostOps(attr, true);
+    // the primitive is set if it was created for the same shapes before, see MKLDNNNode::reshape()
+    if (!prim) {
+        mkldnn::primitive_attr attr;
+        addZeroPoints(attr);
+        setPostOps(attr, true);
 
-    auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
-            convolution_forward::desc>(attr);
+        auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
+                convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+        prim.reset(new convolution_forward(prim_desc));
+    }
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -781,6 +785,14 @@ const mkldnn::memory& MKLDNNConvolutionNode::getBias() const {
     return isWinograd() ? internalBlobMemory[1]->GetPrimitive() : getParentEdgeAt(2)->getMemory().GetPrimitive();
 }
 
+uint64_t MKLDNNConvolutionNode::getFlops() const {
+    if (outDims.empty() || weightDims.empty())
+        return 0;
+    // every output point takes IC / G * KD * KH * KW multiply-adds
+    const uint64_t weightsCount = std::accumulate(weightDims.begin(), weightDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * static_cast<uint64_t>(outDims[0].size()) * weightsCount / outDims[0][1];
+}
+
 InferenceEngine::Precision MKLDNNConvolutionNode::getRuntimePrecision() const {
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
@@ -32,6 +32,7 @@ public:
         return false;
     }
     InferenceEngine::Precision getRuntimePrecision() const override;
+    uint64_t getFlops() const override;
     MKLDNNMemoryDesc getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
     const mkldnn::memory& getWeights() const;
@@ -61,6 +62,11 @@ public:
 
     bool isWinograd() const { return isWino; }
 
+    bool canBeReshaped() const override {
+        // the winograd and fused depthwise convolutions depend on the spatial shape, as well as the automatic paddings
+        return !isWinograd() && !withDWConv && !autoPadding;
+    }
+
 protected:
     InferenceEngine::Precision fusedEltwisePrecision(const MKLDNNNodePtr& fusingNode) const;
 
@@ -81,6 +87,7 @@ private:
     std::vector<ptrdiff_t> dilation;
     std::vector<ptrdiff_t> paddingL;
     std::vector<ptrdiff_t> paddingR;
+    bool autoPadding = false;
     InferenceEngine::SizeVector weightDims;
     InferenceEngine::SizeVector biasesDims;
 
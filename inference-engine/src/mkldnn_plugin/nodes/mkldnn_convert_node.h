@@ -22,6 +22,9 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
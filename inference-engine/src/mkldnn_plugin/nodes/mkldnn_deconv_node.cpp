@@ -9,6 +9,8 @@
 #include <mkldnn.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <functional>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -447,6 +449,14 @@ MKLDNNMemoryDesc MKLDNNDeconvolutionNode::getDstMemDesc(mkldnn::primitive_desc_i
                                                             desc.getBlockingDesc()));
 }
 
+uint64_t MKLDNNDeconvolutionNode::getFlops() const {
+    if (inDims.empty() || weightDims.empty())
+        return 0;
+    // every input point is scattered with OC / G * KD * KH * KW multiply-adds
+    const uint64_t weightsCount = std::accumulate(weightDims.begin(), weightDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * static_cast<uint64_t>(inDims[0].size()) * weightsCount / inDims[0][1];
+}
+
 InferenceEngine::Precision MKLDNNDeconvolutionNode::getRuntimePrecision() const {
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <cmath>
+#include <numeric>
 #include <mkldnn_extension_utils.h>
 
 #include "mkldnn_dft_node.h"
@@ -102,6 +104,17 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
+// signals of this length and longer are split between the threads when there are not enough of them to run in parallel
+constexpr size_t minParallelFFTLength = 4096;
+// butterflies are computed by blocks of this number of groups when a single transform is parallelized
+constexpr size_t butterflyBlock = 256;
+constexpr double PI = 3.14159265358979323846;
+
+struct Complex {
+    float real;
+    float imag;
+};
+
 inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
     return lhsReal * rhsReal - lhsImag * rhsImag;
 }
@@ -110,32 +123,27 @@ inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhs
     return lhsReal * rhsImag + lhsImag * rhsReal;
 }
 
-/*
-    Returns true while we can iterate
-    Specified axis is skipped in counters   
-*/
-inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange, size_t axis) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
+inline Complex operator+(const Complex& lhs, const Complex& rhs) {
+    return {lhs.real + rhs.real, lhs.imag + rhs.imag};
+}
 
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        if (std::distance(itCounter, counters.rend()) == axis + 1) {
-            ++itCounter;
-            ++itWork;
-            continue;
-        }
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            return true;
-        }
-        ++itCounter;
-        ++itWork;
-    }
-    return false;
+inline Complex operator-(const Complex& lhs, const Complex& rhs) {
+    return {lhs.real - rhs.real, lhs.imag - rhs.imag};
+}
+
+inline Complex operator*(const Complex& lhs, const Complex& rhs) {
+    return {getRealFromComplexProd(lhs.real, lhs.imag, rhs.real, rhs.imag),
+            getImaginaryFromComplexProd(lhs.real, lhs.imag, rhs.real, rhs.imag)};
+}
+
+inline Complex operator*(const Complex& lhs, float rhs) {
+    return {lhs.real * rhs, lhs.imag * rhs};
 }
 
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
+// exp(-2 * pi * i * numerator / denominator) evaluated in double precision
+inline Complex unitRoot(uint64_t numerator, uint64_t denominator) {
+    const double phase = -2.0 * PI * static_cast<double>(numerator % denominator) / static_cast<double>(denominator);
+    return {static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))};
 }
 
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
@@ -161,30 +169,6 @@ size_t calculateOffsetFromStrides(const std::vector<size_t>& coords, const std::
     return offset;
 }
 
-void gatherToBufferND(float* buffer, const float* data, size_t axis, const std::vector<size_t>& dimIndexes,
-                                     const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        buffer[bufferIndex] = data[offset];
-        buffer[bufferIndex + 1] = data[offset + 1];
-        offset += strides[axis];
-    }
-}
-
-void applyBufferND(const float* buffer, float* output, size_t axis, const std::vector<size_t>& dimIndexes,
-                                  const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        output[offset] = buffer[bufferIndex];
-        output[offset + 1] = buffer[bufferIndex + 1];
-        offset += strides[axis];
-    }
-}
-
 void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t>& inputShape, const std::vector<size_t>& inputStrides,
                                     float* output, const std::vector<size_t>& outputShape, const std::vector<size_t>& outputStrides) {
     auto totalInput = std::accumulate(inputShape.begin(), inputShape.end(), 1, std::multiplies<size_t>());
@@ -222,6 +206,220 @@ void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t
 
 } // namespace
 
+/*
+    Mixed radix (4, 2, 3, 5) decimation in time FFT, each stage reads the input with a growing stride and writes
+    contiguous output, so no reordering pass is needed. Lengths with other prime factors are computed with
+    Bluestein's algorithm as a circular convolution of a power of two length.
+    Only the forward transform is implemented, the inverse one is computed on the conjugated data.
+*/
+class MKLDNNDFTNode::FFTPlan {
+public:
+    explicit FFTPlan(size_t length) : length(length) {
+        size_t rest = length;
+        for (size_t radix : {4, 2, 3, 5}) {
+            while (rest > 1 && rest % radix == 0) {
+                rest /= radix;
+                factors.push_back(radix);
+                factors.push_back(rest);
+            }
+        }
+        if (rest > 1) {
+            factors.clear();
+            initBluestein();
+            return;
+        }
+
+        twiddles.resize(length);
+        for (size_t k = 0; k < length; ++k) {
+            twiddles[k] = unitRoot(k, length);
+        }
+    }
+
+    // number of complex values needed by transform() as a temporary storage
+    size_t scratchSize() const {
+        return convolution ? 2 * convolution->length : 0;
+    }
+
+    void transform(const Complex* input, Complex* output, Complex* scratch, bool parallel) const {
+        if (length == 1) {
+            output[0] = input[0];
+        } else if (convolution) {
+            bluestein(input, output, scratch, parallel);
+        } else {
+            work(output, input, 1, factors.data(), parallel);
+        }
+    }
+
+private:
+    void initBluestein() {
+        size_t convolutionLength = 1;
+        while (convolutionLength < 2 * length - 1) {
+            convolutionLength *= 2;
+        }
+        convolution = std::make_shared<FFTPlan>(convolutionLength);
+
+        // n^2 is taken modulo 2 * length to keep the phase argument exact
+        chirp.resize(length);
+        for (size_t n = 0; n < length; ++n) {
+            chirp[n] = unitRoot((static_cast<uint64_t>(n) * n) % (2 * length), 2 * length);
+        }
+
+        std::vector<Complex> filter(convolutionLength, Complex{0.0f, 0.0f});
+        const float scale = 1.0f / static_cast<float>(convolutionLength);
+        filter[0] = Complex{chirp[0].real, -chirp[0].imag} * scale;
+        for (size_t n = 1; n < length; ++n) {
+            filter[n] = filter[convolutionLength - n] = Complex{chirp[n].real, -chirp[n].imag} * scale;
+        }
+        filterSpectrum.resize(convolutionLength);
+        convolution->transform(filter.data(), filterSpectrum.data(), nullptr, false);
+    }
+
+    void bluestein(const Complex* input, Complex* output, Complex* scratch, bool parallel) const {
+        const size_t convolutionLength = convolution->length;
+        Complex* signal = scratch;
+        Complex* spectrum = scratch + convolutionLength;
+
+        for (size_t n = 0; n < length; ++n) {
+            signal[n] = input[n] * chirp[n];
+        }
+        std::fill(signal + length, signal + convolutionLength, Complex{0.0f, 0.0f});
+        convolution->transform(signal, spectrum, nullptr, parallel);
+
+        // inverse transform of the product through the conjugation, 1 / convolutionLength is folded into the filter
+        for (size_t k = 0; k < convolutionLength; ++k) {
+            const Complex product = spectrum[k] * filterSpectrum[k];
+            spectrum[k] = Complex{product.real, -product.imag};
+        }
+        convolution->transform(spectrum, signal, nullptr, parallel);
+
+        for (size_t k = 0; k < length; ++k) {
+            output[k] = Complex{signal[k].real, -signal[k].imag} * chirp[k];
+        }
+    }
+
+    void work(Complex* output, const Complex* input, size_t inputStride, const size_t* factor, bool parallel) const {
+        const size_t radix = factor[0];
+        const size_t subLength = factor[1];
+
+        if (subLength == 1) {
+            for (size_t q = 0; q < radix; ++q) {
+                output[q] = input[q * inputStride];
+            }
+        } else {
+            auto subTransform = [&](size_t q) {
+                work(output + q * subLength, input + q * inputStride, inputStride * radix, factor + 2, false);
+            };
+            if (parallel) {
+                parallel_for(radix, subTransform);
+            } else {
+                for (size_t q = 0; q < radix; ++q) {
+                    subTransform(q);
+                }
+            }
+        }
+
+        auto butterflies = [&](size_t begin, size_t end) {
+            switch (radix) {
+                case 2: butterfly2(output, inputStride, subLength, begin, end); break;
+                case 3: butterfly3(output, inputStride, subLength, begin, end); break;
+                case 4: butterfly4(output, inputStride, subLength, begin, end); break;
+                case 5: butterfly5(output, inputStride, subLength, begin, end); break;
+            }
+        };
+        if (parallel) {
+            parallel_for(div_up(subLength, butterflyBlock), [&](size_t block) {
+                butterflies(block * butterflyBlock, std::min(subLength, (block + 1) * butterflyBlock));
+            });
+        } else {
+            butterflies(0, subLength);
+        }
+    }
+
+    void butterfly2(Complex* data, size_t stride, size_t m, size_t begin, size_t end) const {
+        Complex* data1 = data + m;
+        for (size_t u = begin; u < end; ++u) {
+            const Complex t = data1[u] * twiddles[u * stride];
+            data1[u] = data[u] - t;
+            data[u] = data[u] + t;
+        }
+    }
+
+    void butterfly3(Complex* data, size_t stride, size_t m, size_t begin, size_t end) const {
+        const float sin60 = twiddles[stride * m].imag;
+        for (size_t u = begin; u < end; ++u) {
+            const Complex s1 = data[u + m] * twiddles[u * stride];
+            const Complex s2 = data[u + 2 * m] * twiddles[2 * u * stride];
+            const Complex sum = s1 + s2;
+            const Complex diff = (s1 - s2) * sin60;
+            const Complex half = data[u] - sum * 0.5f;
+
+            data[u] = data[u] + sum;
+            data[u + m] = Complex{half.real - diff.imag, half.imag + diff.real};
+            data[u + 2 * m] = Complex{half.real + diff.imag, half.imag - diff.real};
+        }
+    }
+
+    void butterfly4(Complex* data, size_t stride, size_t m, size_t begin, size_t end) const {
+        for (size_t u = begin; u < end; ++u) {
+            const Complex s0 = data[u + m] * twiddles[u * stride];
+            const Complex s1 = data[u + 2 * m] * twiddles[2 * u * stride];
+            const Complex s2 = data[u + 3 * m] * twiddles[3 * u * stride];
+
+            const Complex s5 = data[u] - s1;
+            const Complex first = data[u] + s1;
+            const Complex s3 = s0 + s2;
+            const Complex s4 = s0 - s2;
+
+            data[u] = first + s3;
+            data[u + 2 * m] = first - s3;
+            data[u + m] = Complex{s5.real + s4.imag, s5.imag - s4.real};
+            data[u + 3 * m] = Complex{s5.real - s4.imag, s5.imag + s4.real};
+        }
+    }
+
+    void butterfly5(Complex* data, size_t stride, size_t m, size_t begin, size_t end) const {
+        const Complex ya = twiddles[stride * m];
+        const Complex yb = twiddles[2 * stride * m];
+        for (size_t u = begin; u < end; ++u) {
+            const Complex s0 = data[u];
+            const Complex s1 = data[u + m] * twiddles[u * stride];
+            const Complex s2 = data[u + 2 * m] * twiddles[2 * u * stride];
+            const Complex s3 = data[u + 3 * m] * twiddles[3 * u * stride];
+            const Complex s4 = data[u + 4 * m] * twiddles[4 * u * stride];
+
+            const Complex s7 = s1 + s4;
+            const Complex s10 = s1 - s4;
+            const Complex s8 = s2 + s3;
+            const Complex s9 = s2 - s3;
+
+            data[u] = s0 + s7 + s8;
+
+            const Complex s5 = {s0.real + s7.real * ya.real + s8.real * yb.real, s0.imag + s7.imag * ya.real + s8.imag * yb.real};
+            const Complex s6 = {s10.imag * ya.imag + s9.imag * yb.imag, -s10.real * ya.imag - s9.real * yb.imag};
+            data[u + m] = s5 - s6;
+            data[u + 4 * m] = s5 + s6;
+
+            const Complex s11 = {s0.real + s7.real * yb.real + s8.real * ya.real, s0.imag + s7.imag * yb.real + s8.imag * ya.real};
+            const Complex s12 = {-s10.imag * yb.imag + s9.imag * ya.imag, s10.real * yb.imag - s9.real * ya.imag};
+            data[u + 2 * m] = s11 + s12;
+            data[u + 3 * m] = s11 - s12;
+        }
+    }
+
+    size_t length;
+    // pairs of the stage radix and the length of its sub transforms
+    std::vector<size_t> factors;
+    // exp(-2 * pi * i * k / length)
+    std::vector<Complex> twiddles;
+
+    // Bluestein's algorithm data
+    std::shared_ptr<FFTPlan> convolution;
+    // exp(-pi * i * n^2 / length)
+    std::vector<Complex> chirp;
+    // spectrum of the conjugated chirp scaled by 1 / convolution length
+    std::vector<Complex> filterSpectrum;
+};
+
 void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     auto axesEdge = getParentEdgeAt(AXES_INDEX);
     const auto* axesStartPtr = reinterpret_cast<const int32_t*>(axesEdge->getMemoryPtr()->GetPtr());
@@ -234,13 +432,6 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     std::sort(axes.begin(), axes.end());
 
     outputShape = getChildEdgeAt(0)->getDims().ToSizeVector();
-    for (size_t axis : axes) {
-        size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
-        }
-    }
 
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
     auto outputDataEdge = getChildEdgeAt(0);
@@ -256,165 +447,84 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
         cpu_memcpy(output, input, totalElements * sizeof(float));
     }
 
-    // 1d case
-    if (inputDataEdge->getDesc().getDims().size() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
-    } else {
-        dftNd(output, outputStrides);
+    for (size_t axis : axes) {
+        fftAlongAxis(output, outputStrides, axis);
     }
 }
 
-void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
-    const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
-    const size_t lastDimIndex = iterationRange.size() - 1;
-    for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
-        const size_t currentAxis = axes[axisIndex];
-        const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
+void MKLDNNDFTNode::fftAlongAxis(float* output, const std::vector<size_t>& outputStrides, size_t axis) {
+    const size_t length = outputShape[axis];
+    const auto& plan = getPlan(length);
+
+    // all the dimensions except the transformed one and the trailing pair of real and imaginary parts
+    std::vector<size_t> signalDims, signalStrides;
+    for (size_t dim = 0; dim + 1 < outputShape.size(); ++dim) {
+        if (dim != axis) {
+            signalDims.push_back(outputShape[dim]);
+            signalStrides.push_back(outputStrides[dim]);
         }
     }
-}
-
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
+    const size_t signalsNumber = std::accumulate(signalDims.begin(), signalDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t axisStride = outputStrides[axis];
+    const float conjugate = inverse ? -1.0f : 1.0f;
+    const float scale = inverse ? 1.0f / static_cast<float>(length) : 1.0f;
+
+    auto transformSignals = [&](size_t start, size_t end, bool parallelTransform) {
+        std::vector<Complex> signal(length), spectrum(length), scratch(plan.scratchSize());
+        for (size_t index = start; index < end; ++index) {
+            size_t offset = 0;
+            size_t rest = index;
+            for (int dim = static_cast<int>(signalDims.size()) - 1; dim >= 0; --dim) {
+                offset += (rest % signalDims[dim]) * signalStrides[dim];
+                rest /= signalDims[dim];
+            }
 
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
+            for (size_t n = 0; n < length; ++n) {
+                const float* value = output + offset + n * axisStride;
+                signal[n] = Complex{value[0], conjugate * value[1]};
+            }
+            plan.transform(signal.data(), spectrum.data(), scratch.data(), parallelTransform);
+            for (size_t k = 0; k < length; ++k) {
+                float* value = output + offset + k * axisStride;
+                value[0] = spectrum[k].real * scale;
+                value[1] = conjugate * spectrum[k].imag * scale;
+            }
         }
     };
 
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+    // a few long signals are transformed one by one with the parallel butterflies, otherwise the signals are distributed
+    if (signalsNumber < static_cast<size_t>(parallel_get_max_threads()) && length >= minParallelFFTLength) {
+        transformSignals(0, signalsNumber, true);
+    } else {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(signalsNumber, nthr, ithr, start, end);
+            if (start < end) {
+                transformSignals(start, end, false);
             }
-        }
-    }
-
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
+        });
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+const MKLDNNDFTNode::FFTPlan& MKLDNNDFTNode::getPlan(size_t length) {
+    auto& plan = fftPlans[length];
+    if (!plan) {
+        plan = std::make_shared<const FFTPlan>(length);
+    }
+    return *plan;
 }
 
 bool MKLDNNDFTNode::created() const {
     return getType() == DFT;
 }
 
-void MKLDNNDFTNode::createPrimitive() {}
+void MKLDNNDFTNode::createPrimitive() {
+    // axes may be unknown until the execution, so the plans are prepared for every dimension of the output
+    outputShape = getChildEdgeAt(0)->getDims().ToSizeVector();
+    for (size_t dim = 0; dim + 1 < outputShape.size(); ++dim) {
+        getPlan(outputShape[dim]);
+    }
+}
 
 
 REG_MKLDNN_PRIM_FOR(MKLDNNDFTNode, DFT)
@@ -6,7 +6,10 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -24,13 +27,13 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
-    void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
+    class FFTPlan;
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
+    void fftAlongAxis(float* output, const std::vector<size_t>& outputStrides, size_t axis);
+    const FFTPlan& getPlan(size_t length);
 
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // plans with precomputed twiddle factors keyed by the signal length
+    std::unordered_map<size_t, std::shared_ptr<const FFTPlan>> fftPlans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -38,7 +41,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
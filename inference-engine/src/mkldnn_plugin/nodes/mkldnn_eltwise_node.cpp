@@ -1179,6 +1179,14 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNEltwiseNode::createPrimitive() {
     auto config = getSelectedPrimitiveDescriptor()->getConfig();
 
+    // the primitive is recreated when the graph is reshaped, the dims and offsets of the previous shape are dropped
+    dims_in.clear();
+    dims_out.clear();
+    offsets_in.clear();
+    offsets_out.clear();
+    offsets_oc.clear();
+    start_offset_in.clear();
+
     auto initDims = [this, config](size_t maxInputSize) {
         size_t inputNum = getParentEdges().size();
 
@@ -1394,6 +1402,12 @@ void MKLDNNEltwiseNode::createPrimitive() {
 
     jep.oc_size = oc_size;
 
+    // the kernel depends on the shapes only through the parameters above, so it is reused for the shapes seen before
+    const auto key = getShapesKey();
+    if (reshapedKernels.find(key, eltwise_kernel))
+        return;
+
+    eltwise_kernel.reset();
     if (mayiuse(x64::avx512_common)) {
         eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(jep, *this));
     } else if (mayiuse(x64::avx2)) {
@@ -1402,8 +1416,10 @@ void MKLDNNEltwiseNode::createPrimitive() {
         eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, *this));
     }
 
-    if (eltwise_kernel)
+    if (eltwise_kernel) {
         eltwise_kernel->create_ker();
+        reshapedKernels.put(key, eltwise_kernel);
+    }
 }
 
 void MKLDNNEltwiseNode::selectOptimalPrimitiveDescriptor() {
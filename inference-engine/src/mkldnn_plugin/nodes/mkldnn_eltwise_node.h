@@ -68,6 +68,9 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
     bool canBeInPlace() const override;
     bool canFuse(const MKLDNNNodePtr& node) const override;
     void appendPostOps(mkldnn::post_ops& ops) override;
@@ -86,6 +89,8 @@ private:
     mkldnn::algorithm mkldnnAlgorithm = mkldnn::algorithm::undef;
 
     std::shared_ptr<jit_uni_eltwise_kernel> eltwise_kernel = nullptr;
+    // The kernels generated for the shapes the node was reshaped to
+    MKLDNNShapeCache<std::shared_ptr<jit_uni_eltwise_kernel>> reshapedKernels;
     jit_eltwise_params jep = {};
 
     int optimalTensorRank = 6;
@@ -2,17 +2,145 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include <mkldnn_types.h>
 #include "ie_parallel.hpp"
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_convert.h"
+#include <cpu/x64/jit_generator.hpp>
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+// dst[i] += src[i] * weight, the source row is FP32 or BF16, the accumulator is FP32.
+// Every vector step also prefetches a part of the row which is accumulated next, as the rows are gathered randomly.
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    explicit jit_uni_emb_bag_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_prefetch, ptr[reg_params + GET_OFF(src_prefetch)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_weight, ptr[reg_params + GET_OFF(weight)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vbroadcastss(vmm_weight, ptr[reg_weight]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        const int src_data_size = jcp_.src_dt.size();
+        int step = vlen / sizeof(float);
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            prefetcht0(ptr[reg_prefetch]);
+            load_vector(vmm_src, ptr[reg_src]);
+            uni_vmovups(vmm_dst, ptr[reg_dst]);
+            uni_vfmadd231ps(vmm_dst, vmm_src, vmm_weight);
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+
+            add(reg_src, step * src_data_size);
+            add(reg_prefetch, step * src_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        step = 1;
+        L(tail_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load_scalar(xmm_src, ptr[reg_src]);
+            uni_vmovss(xmm_dst, ptr[reg_dst]);
+            uni_vfmadd231ps(xmm_dst, xmm_src, xmm_weight);
+            uni_vmovss(ptr[reg_dst], xmm_dst);
+
+            add(reg_src, step * src_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_prefetch = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_weight = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Xbyak::Xmm xmm_src = Xbyak::Xmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Xbyak::Xmm xmm_dst = Xbyak::Xmm(1);
+    Vmm vmm_weight = Vmm(2);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(2);
+
+    jit_emb_bag_config_params jcp_;
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        switch (jcp_.src_dt) {
+            case InferenceEngine::Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case InferenceEngine::Precision::BF16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op) {
+        switch (jcp_.src_dt) {
+            case InferenceEngine::Precision::FP32:
+                uni_vmovss(xmm_src, op);
+                break;
+            case InferenceEngine::Precision::BF16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0x0);
+                uni_vpslld(xmm_src, xmm_src, 16);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,73 +170,144 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+void MKLDNNEmbeddingBagSumNode::createKernel(Precision tablePrecision) {
+    if (!one_of(tablePrecision, Precision::FP32, Precision::BF16))
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.src_dt = tablePrecision;
+
+    if (mayiuse(x64::avx512_common)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx2>(jcp));
+    } else if (mayiuse(x64::sse41)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::sse41>(jcp));
+    }
+
+    if (_kernel)
+        _kernel->create_ker();
+}
+
+void MKLDNNEmbeddingBagSumNode::collectBags(size_t bagsNum) {
+    initFromInputs();
+
+    _bags.resize(bagsNum);
+    parallel_for(bagsNum, [&](size_t obi) {
+        BagInfo& bag = _bags[obi];
+        bag = BagInfo();
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        if (bag.indices == nullptr)
+            bag.size = 0lu;
+    });
+
+    _bagsWork.resize(bagsNum + 1lu);
+    _bagsWork[0] = 0lu;
+    for (size_t obi = 0lu; obi < bagsNum; obi++)
+        _bagsWork[obi + 1lu] = _bagsWork[obi] + _bags[obi].size + 1lu;
+}
+
+void MKLDNNEmbeddingBagSumNode::splitBags(int nthr, int ithr, size_t& start, size_t& end) const {
+    // the bags are distributed by the number of the accumulated rows, so a few long bags don't stall a thread.
+    // A bag is processed by the thread whose part of the work contains the beginning of the bag.
+    size_t workStart(0lu), workEnd(0lu);
+    splitter(_bagsWork.back(), nthr, ithr, workStart, workEnd);
+    start = std::lower_bound(_bagsWork.begin(), _bagsWork.end() - 1, workStart) - _bagsWork.begin();
+    end = std::lower_bound(_bagsWork.begin(), _bagsWork.end() - 1, workEnd) - _bagsWork.begin();
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
-    initFromInputs();
-
     const auto& inDataDims = srcDesc.getDims();
-    const size_t outputBagsNum = dstDesc.getDims()[0];
+    collectBags(dstDesc.getDims()[0]);
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        splitBags(nthr, ithr, start, end);
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            const BagInfo& bag = _bags[obi];
+            T* dst = dstData + obi * _embDepth;
+            std::fill(dst, dst + _embDepth, static_cast<T>(0));
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (bag.indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+                const T* src = srcData + bag.indices[inIdx] * _embDepth;
 
-                if (withWeights) {
+                if (bag.withWeights) {
+                    const T weight = weightsData[bag.weightsIdx + inIdx];
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                        dst[i] += src[i] * weight;
                     }
-                    weightsIdx++;
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+                        dst[i] += src[i];
                     }
                 }
+            }
+        }
+    };
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+    parallel_nt(0, threadBody);
+}
+
+template<typename T>
+void MKLDNNEmbeddingBagSumNode::processFloatData(const T* srcData, const T* weightsData, T* dstData,
+                                                 const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    const auto& inDataDims = srcDesc.getDims();
+    collectBags(dstDesc.getDims()[0]);
+
+    // FP32 bags are accumulated right in the destination, the reduced precision ones in a FP32 buffer
+    const bool accumulateInDst = std::is_same<T, float>::value;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitBags(nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> buffer(accumulateInDst ? 0lu : _embDepth);
+
+        for (size_t obi = start; obi < end; obi++) {
+            const BagInfo& bag = _bags[obi];
+            float* acc = accumulateInDst ? reinterpret_cast<float*>(dstData + obi * _embDepth) : buffer.data();
+            std::fill(acc, acc + _embDepth, 0.f);
+
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (bag.indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
                 }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                const T* src = srcData + bag.indices[inIdx] * _embDepth;
+                const float weight = bag.withWeights ? static_cast<float>(weightsData[bag.weightsIdx + inIdx]) : 1.f;
+
+                if (_kernel) {
+                    const bool prefetchNext = inIdx + 1lu < bag.size && bag.indices[inIdx + 1lu] < inDataDims[0];
+
+                    auto arg = jit_emb_bag_call_args();
+                    arg.src = src;
+                    arg.src_prefetch = prefetchNext ? srcData + bag.indices[inIdx + 1lu] * _embDepth : src;
+                    arg.dst = acc;
+                    arg.weight = &weight;
+                    arg.work_amount = _embDepth;
+                    (*_kernel)(&arg);
+                } else {
+                    for (size_t i = 0lu; i < _embDepth; i++) {
+                        acc[i] += static_cast<float>(src[i]) * weight;
+                    }
                 }
             }
+
+            if (!accumulateInDst)
+                cpu_convert(acc, dstData + obi * _embDepth, Precision::FP32, dstDesc.getPrecision(), _embDepth);
         }
     };
 
@@ -119,9 +318,13 @@ void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* w
                                         const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
     switch (srcDesc.getPrecision()) {
         case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
+            return processFloatData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcDesc, dstDesc);
         }
+        case Precision::BF16: {
+            return processFloatData<bfloat16_t>(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const bfloat16_t*>(weightsData), reinterpret_cast<bfloat16_t*>(dstData), srcDesc, dstDesc);
+        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), srcDesc, dstDesc);
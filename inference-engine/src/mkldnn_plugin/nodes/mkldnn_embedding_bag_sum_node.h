@@ -12,6 +12,29 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_call_args {
+    const void* src;
+    const void* src_prefetch;
+    float* dst;
+    const float* weight;
+    size_t work_amount;
+};
+
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision src_dt;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_emb_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -27,6 +50,8 @@ public:
     ~MKLDNNEmbeddingBagSumNode() = default;
 
 protected:
+    void createKernel(InferenceEngine::Precision tablePrecision);
+
     virtual void initFromInputs() = 0;
     virtual void getIndices(
             int embIndex,
@@ -38,6 +63,18 @@ protected:
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
+    template<typename T>
+    void processFloatData(const T* srcData, const T* weightsData, T* dstData,
+                          const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
+
+    struct BagInfo {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+    void collectBags(size_t bagsNum);
+    void splitBags(int nthr, int ithr, size_t& start, size_t& end) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +84,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<BagInfo> _bags;
+    // prefix sums of the work per bag: the number of the accumulated rows plus one for the store
+    std::vector<size_t> _bagsWork;
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -47,11 +47,9 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -74,6 +72,10 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
 }
 
+void MKLDNNEmbeddingSegmentsSumNode::createPrimitive() {
+    createKernel(getParentEdgeAt(EMB_TABLE_IDX)->getDesc().getPrecision());
+}
+
 void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
     indices_ = reinterpret_cast<const int *>(getParentEdgeAt(INDICES_IDX)->getMemoryPtr()->GetPtr());
     indicesSize_ = getParentEdgeAt(INDICES_IDX)->getBlob()->size();
@@ -87,6 +89,18 @@ void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // the ranges of all segments are found in one pass over the segment ids
+    segmentsBegin_.assign(numSegments_, 0);
+    segmentsSize_.assign(numSegments_, 0lu);
+    for (int si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= numSegments_)
+            continue;
+        if (segmentsSize_[segmentId] == 0lu)
+            segmentsBegin_[segmentId] = si;
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -94,17 +108,12 @@ void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indice
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    size = segmentsSize_[embIndex];
+    if (size != 0lu) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
@@ -19,7 +19,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -39,6 +39,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    std::vector<int> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }  // namespace MKLDNNPlugin
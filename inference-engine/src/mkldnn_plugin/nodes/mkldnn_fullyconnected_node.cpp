@@ -12,6 +12,11 @@
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
+#include "common/fc_u4_weights.h"
+#include "ie_parallel.hpp"
+#include <mkldnn_types.h>
+#include <numeric>
+#include <functional>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -24,10 +29,22 @@ bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<ngraph
             errorMessage = "Only legacy FullyConnected operation is supported";
             return false;
         }
-        if (fc->get_input_size() == 3 && std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(BIAS_ID)) == nullptr) {
+        if (fc->get_input_size() >= 3 && std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(BIAS_ID)) == nullptr) {
             errorMessage = "Only Constant operation on 'bias' input is supported";
             return false;
         }
+        if (fc->get_input_size() == 5) {
+            for (size_t i = WEIGHTS_ID; i < fc->get_input_size(); i++) {
+                if (std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(i)) == nullptr) {
+                    errorMessage = "Only Constant operations on 4-bit weights and their decompression parameters inputs are supported";
+                    return false;
+                }
+            }
+            if (fc->get_input_element_type(WEIGHTS_ID) != ngraph::element::u8) {
+                errorMessage = "Doesn't support packed 4-bit weights with precision: " + fc->get_input_element_type(WEIGHTS_ID).get_type_name();
+                return false;
+            }
+        }
         if (!one_of(fc->get_input_shape(DATA_ID).size(), 2, 3, 4)) {
             errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(fc->get_input_shape(DATA_ID).size());
             return false;
@@ -44,7 +61,14 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph:
     if (isSupportedOperation(op, errorMessage)) {
         errorPrefix = "FullyConnected node with name '" + getName() + "'";
 
-        withBiases = op->get_input_size() == 3;
+        withBiases = op->get_input_size() >= 3;
+        withCompressedWeights = op->get_input_size() == 5;
+        if (withCompressedWeights) {
+            const auto& dataShape = op->get_input_shape(DATA_ID);
+            const size_t K = dataShape.size() == 3 ? dataShape[2]
+                                                   : std::accumulate(dataShape.begin() + 1, dataShape.end(), size_t{1}, std::multiplies<size_t>());
+            weightsGroupSize = K / op->get_input_shape(WEIGHTS_SCALES_ID)[1];
+        }
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
@@ -67,11 +91,14 @@ std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsFor
 }
 
 void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
-    if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
+    if (getParentEdges().size() != 2 && getParentEdges().size() != 3 && getParentEdges().size() != 5)
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (withCompressedWeights)
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -120,16 +147,39 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withCompressedWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    addSupportedPrimDesc({{TensorDescCreatorTypes::ncsp, Precision::FP32},
+                          {TensorDescCreatorTypes::ncsp, Precision::U8},
+                          {TensorDescCreatorTypes::ncsp, Precision::FP32},
+                          {TensorDescCreatorTypes::ncsp, Precision::FP32},
+                          {TensorDescCreatorTypes::ncsp, Precision::FP32}},
+                         {{TensorDescCreatorTypes::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (withCompressedWeights) {
+        prepareDecompressedWeights();
         return;
+    }
 
-    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
-    std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
-    prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
-            createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
+    // the primitive is set if it was created for the same shapes before, see MKLDNNNode::reshape()
+    if (!prim) {
+        std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+        std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
+        prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
+                createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+        prim.reset(new inner_product_forward(*prim_desc));
+    }
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -141,7 +191,9 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (withCompressedWeights) {
+        executeWithCompressedWeights();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -163,7 +215,82 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNFullyConnectedNode::prepareDecompressedWeights() {
+    // the compiled shapes give the upper bound of the rows processed on inference
+    const auto srcDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const auto dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    const size_t maxM = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    if (decompressedWeights || maxM <= fc_u4_weights_max_rows)
+        return;
+
+    const size_t N = dstDims.back();
+    const size_t K = std::accumulate(srcDims.begin(), srcDims.end(), size_t{1}, std::multiplies<size_t>()) / maxM;
+    const auto weights = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto scales = getParentEdgeAt(WEIGHTS_SCALES_ID)->getMemoryPtr();
+    const auto zeroPoints = getParentEdgeAt(WEIGHTS_ZERO_POINTS_ID)->getMemoryPtr();
+    const MKLDNNMemoryDesc desc({static_cast<ptrdiff_t>(N), static_cast<ptrdiff_t>(K)}, memory::data_type::f32, memory::format_tag::nc);
+
+    auto create = [&] () {
+        auto ptr = std::make_shared<MKLDNNMemory>(getEngine());
+        ptr->Create(desc);
+        decompress_u4_weights(reinterpret_cast<const uint8_t *>(weights->GetPtr()),
+                              reinterpret_cast<const float *>(scales->GetPtr()),
+                              reinterpret_cast<const float *>(zeroPoints->GetPtr()),
+                              reinterpret_cast<float *>(ptr->GetPtr()), N, K, weightsGroupSize);
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        // the decompressed weights depend on the packed weights and on their decompression parameters
+        std::string key = "u4_decompressed";
+        uint64_t checksum = 0;
+        for (const auto& mem : {weights, scales, zeroPoints}) {
+            key += "_" + MKLDNNWeightsSharing::GetContentKey(mem->GetPtr(), mem->GetSize(), mem->GetDesc(), desc);
+            checksum = checksum * 31 + MKLDNNWeightsSharing::GetContentChecksum(mem->GetPtr(), mem->GetSize());
+        }
+        decompressedWeights = *weightCache->findOrCreate(key, create, true, checksum);
+    } else {
+        decompressedWeights = create();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithCompressedWeights() {
+    auto inputPtr = [this](size_t port) {
+        return getParentEdgeAt(port)->getMemoryPtr()->GetPtr();
+    };
+
+    const auto srcDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const auto dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    const size_t N = dstDims.back();
+    // The rows of the batch are processed only up to the dynamic batch limit, the first dimension is the batch one
+    const size_t rowsPerBatch = std::accumulate(dstDims.begin() + 1, dstDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t M = static_cast<size_t>(batchToProcess()) * rowsPerBatch;
+    const size_t K = std::accumulate(srcDims.begin() + 1, srcDims.end(), size_t{1}, std::multiplies<size_t>()) / rowsPerBatch;
+
+    if (M > fc_u4_weights_max_rows && decompressedWeights) {
+        const auto bias = reinterpret_cast<const float *>(inputPtr(BIAS_ID));
+        auto dst = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+        parallel_for(M, [&](size_t m) {
+            std::copy(bias, bias + N, dst + m * N);
+        });
+        mkldnn_sgemm('N', 'T', M, N, K, 1.f, reinterpret_cast<const float *>(inputPtr(DATA_ID)), K,
+                     reinterpret_cast<const float *>(decompressedWeights->GetPtr()), K, 1.f, dst, N);
+        return;
+    }
+
+    fc_u4_weights(reinterpret_cast<const float *>(inputPtr(DATA_ID)),
+                  reinterpret_cast<const uint8_t *>(inputPtr(WEIGHTS_ID)),
+                  reinterpret_cast<const float *>(inputPtr(WEIGHTS_SCALES_ID)),
+                  reinterpret_cast<const float *>(inputPtr(WEIGHTS_ZERO_POINTS_ID)),
+                  reinterpret_cast<const float *>(inputPtr(BIAS_ID)),
+                  reinterpret_cast<float *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr()),
+                  M, N, K, weightsGroupSize);
+}
+
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // post operations are applied by oneDNN primitives only
+    if (withCompressedWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -193,6 +320,13 @@ bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
 
+std::vector<MKLDNNDims> MKLDNNFullyConnectedNode::shapeInfer(const std::vector<MKLDNNDims>& inputDims) const {
+    // FullyConnected operation keeps the output shape as an attribute, only the last dimension is known from the weights
+    auto dims = inputDims[DATA_ID].ToSizeVector();
+    dims.back() = outDims[0].ToSizeVector().back();
+    return {MKLDNNDims(dims)};
+}
+
 const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
@@ -238,6 +372,9 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (withCompressedWeights)
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
@@ -313,6 +450,13 @@ MKLDNNMemoryDesc MKLDNNFullyConnectedNode::getDstMemDesc(mkldnn::primitive_desc_
     }
 }
 
+uint64_t MKLDNNFullyConnectedNode::getFlops() const {
+    if (outDims.empty() || weightsDims.empty())
+        return 0;
+    const uint64_t weightsCount = std::accumulate(weightsDims.begin(), weightsDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * static_cast<uint64_t>(outDims[0].size()) * weightsCount / weightsDims[0];
+}
+
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
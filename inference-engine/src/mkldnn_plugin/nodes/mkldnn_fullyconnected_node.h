@@ -18,9 +18,14 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
+    std::vector<MKLDNNDims> shapeInfer(const std::vector<MKLDNNDims>& inputDims) const override;
 
     bool canBeInPlace() const override {
         return false;
@@ -38,6 +43,7 @@ public:
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
+    uint64_t getFlops() const override;
 
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
@@ -55,10 +61,20 @@ private:
 
     bool withBiases = false;
 
+    // 4-bit weights are packed two per byte and decompressed on the fly with per group scales and zero points
+    bool withCompressedWeights = false;
+    size_t weightsGroupSize = 0;
+    // f32 weights decompressed once for the shapes with too many rows for the on the fly decompression
+    MKLDNNMemoryPtr decompressedWeights;
+    void prepareDecompressedWeights();
+    void executeWithCompressedWeights();
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
+    static const size_t WEIGHTS_SCALES_ID = 3;
+    static const size_t WEIGHTS_ZERO_POINTS_ID = 4;
 };
 
 }  // namespace MKLDNNPlugin
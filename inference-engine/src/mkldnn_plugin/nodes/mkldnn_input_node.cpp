@@ -329,16 +329,15 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         return false;
     };
 
-    auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
-        return getName()
-                + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+    // the key doesn't depend on the node, so the constants with identical data are stored once for all the networks
+    auto blobKey = [&] () {
+        return "const_" + MKLDNNWeightsSharing::GetContentKey(constOp->get_data_ptr(), size * prec.size(),
+                                                              memDesc, memDesc);
     };
 
     if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        const auto checksum = MKLDNNWeightsSharing::GetContentChecksum(constOp->get_data_ptr(), size * prec.size());
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob, true, checksum);
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new MKLDNNMemory(getEngine());
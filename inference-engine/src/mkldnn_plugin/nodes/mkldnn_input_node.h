@@ -21,6 +21,9 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
 
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
@@ -11,6 +11,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_kernel_cache.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
 
@@ -1641,6 +1642,23 @@ using ngInterpCoordTransf = ngraph::opset4::Interpolate::CoordinateTransformMode
 using ngInterpNearMode = ngraph::opset4::Interpolate::NearestMode;
 using ngInterpShapeCalcMode = ngraph::opset4::Interpolate::ShapeCalcMode;
 
+// The post ops refer to the data of the particular node, so only the kernels without post ops are shared
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_interpolate_kernel> createInterpolateKernel(const jit_interpolate_config_params& jcp,
+                                                                           const mkldnn::primitive_attr& attr) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_interpolate_kernel> kernel(new jit_uni_interpolate_kernel_f32<isa>(jcp, *attr.get()));
+        kernel->create_ker();
+        return kernel;
+    };
+    if (attr.get_post_ops().len() != 0)
+        return create();
+    MKLDNNKernelKey key("interpolate");
+    key << isa << jcp.layout << jcp.mode << jcp.src_dt << jcp.dst_dt << jcp.indices_size << jcp.spatial_dim_size
+        << jcp.ID << jcp.IH << jcp.IW << jcp.OD << jcp.OH << jcp.OW;
+    return MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_interpolate_kernel>(key, create);
+}
+
 bool MKLDNNInterpolateNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto interp = std::dynamic_pointer_cast<const ngraph::opset4::Interpolate>(op);
@@ -2021,20 +2039,18 @@ void MKLDNNInterpolateNode::createPrimitive() {
     if (mode == InterpolateMode::nearest || mode == InterpolateMode::linear_onnx || mode == InterpolateMode::cubic) {
         if (jcp.layout != InterpolateLayoutType::planar) {
             if (mayiuse(cpu::x64::avx512_common)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx512_common>(jcp, attr);
             } else if (mayiuse(cpu::x64::avx2)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx2>(jcp, attr);
             } else if (mayiuse(cpu::x64::sse41)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::sse41>(jcp, attr);
             }
         } else {
             // gather ISA(for planar JIT kernel) for avx2 and fp32
             if (mayiuse(cpu::x64::avx2) && inputPrec == Precision::FP32) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createInterpolateKernel<cpu::x64::avx2>(jcp, attr);
             }
         }
-        if (interpolateKernel)
-            interpolateKernel->create_ker();
     }
 
     // build indices table
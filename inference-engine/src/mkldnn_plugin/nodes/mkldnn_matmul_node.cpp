@@ -8,16 +8,26 @@
 #include <memory>
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "mkldnn_eltwise_node.h"
 #include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// Batches are distributed between threads unless there are too few of them to load all the threads
+// and a single gemm is large enough to be parallelized efficiently on its own
+constexpr size_t largeGemmOpsNum = 1 << 24;
+
+}  // namespace
+
 bool MKLDNNMatMulNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto matMul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(op);
@@ -90,6 +100,15 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
     if (inDims0[xAxis0] != inDims1[yAxis1] || inDims0[yAxis0] != outDims[yAxis] || inDims1[xAxis1] != outDims[xAxis])
         IE_THROW()  << errorPrefix << " has incorrect spatial input and output dimensions";
 
+    initOffsets(inDims0, inDims1, outDims);
+}
+
+void MKLDNNMatMulNode::initOffsets(const MKLDNNDims& inDims0, const MKLDNNDims& inDims1, const MKLDNNDims& outDims) {
+    aOffsets.clear();
+    bOffsets.clear();
+    cOffsets.clear();
+
+    int nDims = inDims0.ndims();
     for (int dim_idx = nDims - 3; dim_idx >= 0; dim_idx--) {
         if ((inDims0[dim_idx] != outDims[dim_idx] && inDims0[dim_idx] != 1) ||
             (inDims1[dim_idx] != outDims[dim_idx] && inDims1[dim_idx] != 1)) {
@@ -179,6 +198,74 @@ void MKLDNNMatMulNode::createPrimitive() {
         IE_THROW()  << errorPrefix << " did not allocate input memory";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
+
+    setPostOps(attr);
+
+    eltwise_injectors_ref.clear();
+    depthwise_injectors_ref.clear();
+    const auto &p = (*attr.get()).post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            eltwise_injectors_ref.push_back(std::make_shared<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>(
+                post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+        } else if (post_op.is_depthwise()) {
+            depthwise_injectors_ref.push_back(std::make_shared<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>(
+                post_op.depthwise.alg));
+        }
+    }
+}
+
+void MKLDNNMatMulNode::reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims) {
+    // the batch strides of the inputs depend on the shapes, the gemm sizes are taken from the edges on execution
+    initOffsets(newInputDims[0], newInputDims[1], newOutputDims[0]);
+    MKLDNNNode::reshape(newInputDims, newOutputDims);
+}
+
+void MKLDNNMatMulNode::setPostOps(mkldnn::primitive_attr &attr) {
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops);
+            continue;
+        }
+
+        IE_THROW() << errorPrefix << " does not support fusing with " << NameFromType(node->getType());
+    }
+
+    attr.set_post_ops(ops);
+}
+
+void MKLDNNMatMulNode::postProcessRow(float *dst, int N, int channel, bool s32Output) {
+    if (s32Output) {
+        const int32_t *dst_s32 = reinterpret_cast<const int32_t *>(dst);
+        for (int n = 0; n < N; n++)
+            dst[n] = static_cast<float>(dst_s32[n]);
+    }
+
+    const auto &p = (*attr.get()).post_ops_;
+    int eltwise_inj_idx = 0;
+    int depthwise_inj_idx = 0;
+    for (int i = 0; i < p.len(); i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            auto &injector = *eltwise_injectors_ref[eltwise_inj_idx];
+            for (int n = 0; n < N; n++)
+                dst[n] = injector.compute_scalar(dst[n]);
+            eltwise_inj_idx++;
+        } else if (post_op.is_depthwise()) {
+            auto &injector = *depthwise_injectors_ref[depthwise_inj_idx];
+            const float *depthwise_weights = post_op.depthwise.weights_data;
+            const float *depthwise_bias = post_op.depthwise.biases_data;
+            for (int n = 0; n < N; n++) {
+                const int c = channel < 0 ? n : channel;
+                dst[n] = injector.compute_scalar(dst[n], depthwise_weights + c, depthwise_bias + c);
+            }
+            depthwise_inj_idx++;
+        }
+    }
 }
 
 inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const float *A, int lda,
@@ -196,9 +283,6 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     const int32_t co = 0;
     int32_t *Ci = reinterpret_cast<int32_t *>(C);
     mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
 }
 
 inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const int8_t *A, int lda,
@@ -206,9 +290,6 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     const int32_t co = 0;
     int32_t *Ci = reinterpret_cast<int32_t *>(C);
     mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
 }
 
 template<typename T0, typename T1>
@@ -240,22 +321,45 @@ void MKLDNNMatMulNode::process_data() {
 
     beta = 0.f;
 
-    for (int b1 = 0; b1 < MB1; b1++) {
-        const T0 *a_ptr = src0_ptr;
-        const T1 *b_ptr = src1_ptr;
-        float *d_ptr = dst_ptr;
+    // The integer gemms accumulate into the destination buffer as s32
+    const bool s32Output = std::is_same<T1, int8_t>::value;
+    const int nDims = outDims.ndims();
 
-        for (int b2 = 0; b2 < MB2; b2++) {
-            process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
-
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += M * N;
+    auto processBatch = [&](int b1, int b2) {
+        const T0 *a_ptr = src0_ptr + b1 * aOffsets[1] + b2 * aOffsets[0];
+        const T1 *b_ptr = src1_ptr + b1 * bOffsets[1] + b2 * bOffsets[0];
+        float *d_ptr = dst_ptr + (static_cast<size_t>(b1) * MB2 + b2) * M * N;
+        process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+        return d_ptr;
+    };
+    // Fused per channel operations broadcast along the second output axis, the rows of 2D output lie along it
+    auto rowChannel = [&](int b2, int m) {
+        return nDims == 2 ? -1 : nDims == 3 ? m : b2;
+    };
+    const bool withPostProcessing = s32Output || !fusedWith.empty();
+
+    const size_t batchesNum = static_cast<size_t>(MB1) * MB2;
+    const size_t gemmOpsNum = static_cast<size_t>(M) * N * K;
+    if (batchesNum == 1 || (batchesNum < static_cast<size_t>(parallel_get_max_threads()) && gemmOpsNum >= largeGemmOpsNum)) {
+        for (int b1 = 0; b1 < MB1; b1++) {
+            for (int b2 = 0; b2 < MB2; b2++) {
+                float *d_ptr = processBatch(b1, b2);
+                if (withPostProcessing) {
+                    parallel_for(M, [&](int m) {
+                        postProcessRow(d_ptr + static_cast<size_t>(m) * N, N, rowChannel(b2, m), s32Output);
+                    });
+                }
+            }
         }
-
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+    } else {
+        // Each thread processes whole 2D slices, so the fused operations are applied while the slice is hot in cache
+        parallel_for2d(MB1, MB2, [&](int b1, int b2) {
+            float *d_ptr = processBatch(b1, b2);
+            if (withPostProcessing) {
+                for (int m = 0; m < M; m++)
+                    postProcessRow(d_ptr + static_cast<size_t>(m) * N, N, rowChannel(b2, m), s32Output);
+            }
+        });
     }
 }
 
@@ -282,12 +386,25 @@ bool MKLDNNMatMulNode::created() const {
     return getType() == MatMul;
 }
 
+bool MKLDNNMatMulNode::canFuse(const MKLDNNNodePtr& node) const {
+    // Only f32 outputs are produced, so the operations changing the output precision are not fused
+    return node->getType() == Eltwise && canFuseSimpleOperation(node);
+}
+
 int MKLDNNMatMulNode::getMaxBatch() {
     if (!outDims.empty())
         return outDims[0][0];
     return 0;
 }
 
+uint64_t MKLDNNMatMulNode::getFlops() const {
+    if (inDims.empty() || outDims.empty())
+        return 0;
+    const auto& aDims = inDims[0];
+    const size_t K = transposeA ? aDims[aDims.ndims() - 2] : aDims[aDims.ndims() - 1];
+    return 2 * static_cast<uint64_t>(outDims[0].size()) * K;
+}
+
 InferenceEngine::Precision MKLDNNMatMulNode::getRuntimePrecision() const {
     return MKLDNNExtensionUtils::getMaxPrecision(getInputPrecisions());
 }
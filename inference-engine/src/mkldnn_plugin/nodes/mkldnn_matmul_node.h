@@ -8,6 +8,9 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <cpu/ref_eltwise.hpp>
+#include <cpu/ref_depthwise_injector.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -21,9 +24,15 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
     int getMaxBatch() override;
+    bool canBeReshaped() const override {
+        return true;
+    }
+    void reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims) override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
+    uint64_t getFlops() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
@@ -41,6 +50,17 @@ private:
     std::vector<int> cOffsets;
 
     template<typename T0, typename T1> void process_data();
+    void initOffsets(const MKLDNNDims& inDims0, const MKLDNNDims& inDims1, const MKLDNNDims& outDims);
+
+    void setPostOps(mkldnn::primitive_attr &attr);
+    /* Converts the gemm output row to f32 if it is accumulated in s32 and applies fused operations to it.
+     * channel is the index along the second output axis, negative value means that the row lies along this axis
+     */
+    void postProcessRow(float *dst, int N, int channel, bool s32Output);
+
+    mkldnn::primitive_attr attr;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>> eltwise_injectors_ref;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>> depthwise_injectors_ref;
 
     std::string errorPrefix;
 };
@@ -11,6 +11,7 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_eltwise_node.h"
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_kernel_cache.hpp>
 #include "utils/bfloat16.hpp"
 #include "ie_parallel.hpp"
 #include "emitters/jit_load_store_emitters.hpp"
@@ -601,6 +602,35 @@ private:
 };
 //////////////////////////////////////////////////////////////////////////////////
 
+static MKLDNNKernelKey makeMVNKernelKey(const std::string& kernelName, cpu_isa_t isa, const jit_mvn_config_params& jcp) {
+    MKLDNNKernelKey key(kernelName);
+    key << isa << jcp.planar_layout << jcp.across_channels << jcp.normalize_variance << jcp.src_prc.getPrecVal() << jcp.dst_prc.getPrecVal()
+        << jcp.C << jcp.D << jcp.H << jcp.W;
+    return key;
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_mean_variance_kernel> createMVNMeanVarianceKernel(const jit_mvn_config_params& jcp) {
+    return MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel>(makeMVNKernelKey("mvn_mean_variance", isa, jcp), [&] {
+        std::shared_ptr<jit_uni_mvn_mean_variance_kernel> kernel(new jit_uni_mvn_mean_variance_kernel_f32<isa>(jcp));
+        kernel->create_ker();
+        return kernel;
+    });
+}
+
+// The post ops refer to the data of the particular node, so only the kernels without post ops are shared
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_kernel> createMVNKernel(const jit_mvn_config_params& jcp, const mkldnn::primitive_attr& attr) {
+    auto create = [&] {
+        std::shared_ptr<jit_uni_mvn_kernel> kernel(new jit_uni_mvn_kernel_f32<isa>(jcp, *attr.get()));
+        kernel->create_ker();
+        return kernel;
+    };
+    if (attr.get_post_ops().len() != 0)
+        return create();
+    return MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_kernel>(makeMVNKernelKey("mvn", isa, jcp), create);
+}
+
 bool MKLDNNMVNNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (op->get_output_partial_shape(0).rank().is_dynamic()) {
@@ -693,6 +723,7 @@ MKLDNNMVNNode::MKLDNNMVNNode(const std::shared_ptr<ngraph::Node>& op, const mkld
         epsMode_ = INSIDE_SQRT;
         acrossChannels_ = mvnOp->get_across_channels();
     }
+    initAcrossChannels_ = acrossChannels_;
 }
 
 void MKLDNNMVNNode::getSupportedDescriptors() {
@@ -820,45 +851,38 @@ void MKLDNNMVNNode::createPrimitive() {
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = shape5D;
 
     if (mayiuse(cpu::x64::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::avx512_common>(jcp, attr);
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::avx512_common>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::avx512_common>(jcp);
         }
     } else if (mayiuse(cpu::x64::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::avx2>(jcp, attr);
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::avx2>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::avx2>(jcp);
         }
     } else if (mayiuse(cpu::x64::sse41)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+        mvn_kernel = createMVNKernel<cpu::x64::sse41>(jcp, attr);
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+        mvn_mean_kernel = createMVNMeanVarianceKernel<cpu::x64::sse41>(jcp);
         if (normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+            mvn_variance_kernel = createMVNMeanVarianceKernel<cpu::x64::sse41>(jcp);
         }
     }
-
-    if (mvn_kernel)
-        mvn_kernel->create_ker();
-
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
 }
 
 void MKLDNNMVNNode::transformTo5DCase(const SizeVector& shape) {
+    // the primitive is created again when the graph is reshaped
+    acrossChannels_ = initAcrossChannels_;
     switch (shape.size()) {
         // for 1 and 2 rank, if acrossChannels_ is true, adjust shape to fully vectorize under unified 5d procedure.
         // otherwise there are not enough data in spatial dimension to process in one kernel.
@@ -83,6 +83,9 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canBeReshaped() const override {
+        return true;
+    }
 
     inline bool getAcrossChannels() const {
         return acrossChannels_;
@@ -108,6 +111,8 @@ private:
     std::tuple<size_t, size_t, size_t, size_t, size_t> shape5D;
 
     bool acrossChannels_ = false;
+    // acrossChannels_ is reset for 1D and 2D shapes when the primitive is created, the value of the operation is kept here
+    bool initAcrossChannels_ = false;
     bool normalizeVariance_ = true;
     float epsValue_ = 1e-9f;
     // Defines way to add epsilon: inside sqrt or outside.
@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <utility>
 #include <queue>
+#include <atomic>
+#include <numeric>
 
 #include "mkldnn_non_max_suppression_node.h"
 #include "ie_parallel.hpp"
@@ -17,6 +19,92 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+constexpr size_t minSortChunkSize = 64lu;
+
+inline float boxArea(const float *corner) {
+    return (corner[2] - corner[0]) * (corner[3] - corner[1]);
+}
+
+// Selected boxes of one batch and class in the corner format. Every coordinate is stored in a separate array,
+// so that the compiler vectorizes the check of a candidate box against all the selected boxes.
+class keptBoxes {
+public:
+    explicit keptBoxes(size_t capacity) {
+        for (auto coord : {&ymin, &xmin, &ymax, &xmax, &area})
+            coord->reserve(capacity);
+    }
+
+    size_t size() const {
+        return area.size();
+    }
+
+    void push_back(const float *corner, float cornerArea) {
+        ymin.push_back(corner[0]);
+        xmin.push_back(corner[1]);
+        ymax.push_back(corner[2]);
+        xmax.push_back(corner[3]);
+        area.push_back(cornerArea);
+    }
+
+    float intersectionOverUnion(const float *corner, float cornerArea, size_t idx) const {
+        return iou(corner[0], corner[1], corner[2], corner[3], cornerArea,
+                   ymin[idx], xmin[idx], ymax[idx], xmax[idx], area[idx]);
+    }
+
+    // Returns true if IoU of the box with at least one of the selected boxes is not less than the threshold
+    bool overlaps(const float *corner, float cornerArea, float iouThreshold) const {
+        // The selected boxes are checked by blocks to stop early without breaking the vectorization of the inner loop
+        constexpr size_t blockSize = 16lu;
+        const float yminI = corner[0], xminI = corner[1], ymaxI = corner[2], xmaxI = corner[3];
+        const float *yminJ = ymin.data(), *xminJ = xmin.data(), *ymaxJ = ymax.data(), *xmaxJ = xmax.data();
+        const float *areaJ = area.data();
+        for (size_t begin = 0; begin < size(); begin += blockSize) {
+            const size_t end = (std::min)(begin + blockSize, size());
+            int overlapped = 0;
+            for (size_t j = begin; j < end; j++) {
+                overlapped |= iou(yminI, xminI, ymaxI, xmaxI, cornerArea, yminJ[j], xminJ[j], ymaxJ[j], xmaxJ[j], areaJ[j]) >= iouThreshold;
+            }
+            if (overlapped)
+                return true;
+        }
+        return false;
+    }
+
+private:
+    static inline float iou(float yminI, float xminI, float ymaxI, float xmaxI, float areaI,
+                            float yminJ, float xminJ, float ymaxJ, float xmaxJ, float areaJ) {
+        const float intersection_area =
+                (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
+                (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
+        return areaI <= 0.f || areaJ <= 0.f ? 0.f : intersection_area / (areaI + areaJ - intersection_area);
+    }
+
+    std::vector<float> ymin, xmin, ymax, xmax, area;
+};
+
+// Calls func(batch_idx, class_idx) for all the batches and classes. The number of candidates can differ a lot from class
+// to class, so the classes with the most candidates are started first and every thread takes the next class when it is free.
+template <typename F>
+void parallelForCandidates(const std::vector<MKLDNNNonMaxSuppressionNode::candidateBoxes> &candidates, size_t num_classes, const F &func) {
+    std::vector<size_t> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0lu);
+    std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+        return candidates[l].size() > candidates[r].size();
+    });
+
+    std::atomic<size_t> next = {0lu};
+    const int threadsNum = static_cast<int>((std::min)(order.size(), static_cast<size_t>(parallel_get_max_threads())));
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        for (size_t i = next++; i < order.size(); i = next++) {
+            func(static_cast<int>(order[i] / num_classes), static_cast<int>(order[i] % num_classes));
+        }
+    });
+}
+
+}  // namespace
+
 bool MKLDNNNonMaxSuppressionNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto nms = std::dynamic_pointer_cast<const ngraph::op::internal::NonMaxSuppressionIEInternal>(op);
@@ -174,10 +262,13 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
 
     std::vector<filteredBoxes> filtBoxes(max_output_boxes_per_class * num_batches * num_classes);
 
+    std::vector<candidateBoxes> candidates;
+    gatherCandidates(scores, scoresStrides, candidates);
+
     if (soft_nms_sigma == 0.0f) {
-        nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithoutSoftSigma(boxes, boxesStrides, candidates, filtBoxes);
     } else {
-        nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithSoftSigma(boxes, boxesStrides, candidates, filtBoxes);
     }
 
     size_t startOffset = numFiltBox[0][0];
@@ -237,43 +328,37 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
-float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+void MKLDNNNonMaxSuppressionNode::toCorner(const float *box, float *corner) const {
     if (boxEncodingType == boxEncoding::CENTER) {
         //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+        corner[0] = box[1] - box[3] / 2.f;
+        corner[1] = box[0] - box[2] / 2.f;
+        corner[2] = box[1] + box[3] / 2.f;
+        corner[3] = box[0] + box[2] / 2.f;
     } else {
         //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+        corner[0] = (std::min)(box[0], box[2]);
+        corner[1] = (std::min)(box[1], box[3]);
+        corner[2] = (std::max)(box[0], box[2]);
+        corner[3] = (std::max)(box[1], box[3]);
     }
+}
 
-    float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-    float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+void MKLDNNNonMaxSuppressionNode::gatherCandidates(const float *scores, const SizeVector &scoresStrides,
+                                                   std::vector<candidateBoxes> &candidates) {
+    candidates.resize(num_batches * num_classes);
+    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+        auto &classCandidates = candidates[batch_idx * num_classes + class_idx];
+        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+            if (scoresPtr[box_idx] > score_threshold)
+                classCandidates.push_back({scoresPtr[box_idx], box_idx, 0});
+        }
+    });
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                                                             const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const SizeVector &boxesStrides,
+                                                   std::vector<candidateBoxes> &candidates, std::vector<filteredBoxes> &filtBoxes) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
@@ -283,45 +368,45 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         return iou <= iou_threshold ? weight : 0.0f;
     };
 
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+    parallelForCandidates(candidates, num_classes, [&](int batch_idx, int class_idx) {
         std::vector<filteredBoxes> fb;
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-        }
-
-        fb.reserve(sorted_boxes.size());
-        if (sorted_boxes.size() > 0) {
-            while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
-                boxInfo currBox = sorted_boxes.top();
-                float origScore = currBox.score;
-                sorted_boxes.pop();
-
-                bool box_is_selected = true;
-                for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
-                    currBox.score *= coeff(iou);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                    if (currBox.score <= score_threshold)
-                        break;
+        // the heap is built from all the candidates at once in linear time
+        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less,
+                std::move(candidates[batch_idx * num_classes + class_idx]));
+
+        fb.reserve(std::min(sorted_boxes.size(), max_output_boxes_per_class));
+        keptBoxes kept(fb.capacity());
+        float corner[4];
+        while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
+            boxInfo currBox = sorted_boxes.top();
+            float origScore = currBox.score;
+            sorted_boxes.pop();
+
+            toCorner(&boxesPtr[currBox.idx * 4], corner);
+            const float area = boxArea(corner);
+            bool box_is_selected = true;
+            for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
+                float iou = kept.intersectionOverUnion(corner, area, idx);
+                currBox.score *= coeff(iou);
+                if (iou >= iou_threshold) {
+                    box_is_selected = false;
+                    break;
                 }
+                if (currBox.score <= score_threshold)
+                    break;
+            }
 
-                currBox.suppress_begin_index = fb.size();
-                if (box_is_selected) {
-                    if (currBox.score == origScore) {
-                        fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
-                        continue;
-                    }
-                    if (currBox.score > score_threshold) {
-                        sorted_boxes.push(currBox);
-                    }
+            currBox.suppress_begin_index = fb.size();
+            if (box_is_selected) {
+                if (currBox.score == origScore) {
+                    fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                    kept.push_back(corner, area);
+                    continue;
+                }
+                if (currBox.score > score_threshold) {
+                    sorted_boxes.push(currBox);
                 }
             }
         }
@@ -333,45 +418,43 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
     });
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                                                                const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(max_output_boxes_per_class);
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
-        std::vector<std::pair<float, int>> sorted_boxes;
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const SizeVector &boxesStrides,
+                                                      std::vector<candidateBoxes> &candidates, std::vector<filteredBoxes> &filtBoxes) {
+    auto greater = [](const boxInfo& l, const boxInfo& r) {
+        return l.score > r.score || ((l.score == r.score) && (l.idx < r.idx));
+    };
 
-        int io_selection_size = 0;
-        if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
+    parallelForCandidates(candidates, num_classes, [&](int batch_idx, int class_idx) {
+        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        auto &sorted_boxes = candidates[batch_idx * num_classes + class_idx];
+        const size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+
+        // Usually only a small part of the candidates is examined before max_output_boxes_per_class boxes are selected,
+        // so the candidates are sorted by chunks: the best remaining candidates are partitioned in linear time
+        // and only they are sorted. Every next chunk is twice as large as the previous one.
+        size_t chunkSize = (std::max)(2 * max_output_boxes_per_class, minSortChunkSize);
+        size_t sortedEnd = 0;
+
+        keptBoxes kept((std::min)(sorted_boxes.size(), max_output_boxes_per_class));
+        float corner[4];
+        for (size_t box_idx = 0; box_idx < sorted_boxes.size() && kept.size() < max_output_boxes_per_class; box_idx++) {
+            if (box_idx == sortedEnd) {
+                sortedEnd = (std::min)(sortedEnd + chunkSize, sorted_boxes.size());
+                if (sortedEnd < sorted_boxes.size())
+                    std::nth_element(sorted_boxes.begin() + box_idx, sorted_boxes.begin() + sortedEnd, sorted_boxes.end(), greater);
+                std::sort(sorted_boxes.begin() + box_idx, sorted_boxes.begin() + sortedEnd, greater);
+                chunkSize *= 2;
+            }
 
-                if (box_is_selected) {
-                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                    io_selection_size++;
-                }
+            const boxInfo &currBox = sorted_boxes[box_idx];
+            toCorner(&boxesPtr[currBox.idx * 4], corner);
+            const float area = boxArea(corner);
+            if (!kept.overlaps(corner, area, iou_threshold)) {
+                filtBoxes[offset + kept.size()] = filteredBoxes(currBox.score, batch_idx, class_idx, currBox.idx);
+                kept.push_back(corner, area);
             }
         }
-        numFiltBox[batch_idx][class_idx] = io_selection_size;
+        numFiltBox[batch_idx][class_idx] = kept.size();
     });
 }
 
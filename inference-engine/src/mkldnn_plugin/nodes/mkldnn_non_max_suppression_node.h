@@ -42,13 +42,16 @@ public:
         int suppress_begin_index;
     };
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ);
+    // Boxes of one batch and class which scores are above the score threshold, in no particular order
+    using candidateBoxes = std::vector<boxInfo>;
 
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                          const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+    void gatherCandidates(const float *scores, const SizeVector &scoresStrides, std::vector<candidateBoxes> &candidates);
 
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                             const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+    void nmsWithSoftSigma(const float *boxes, const SizeVector &boxesStrides,
+                          std::vector<candidateBoxes> &candidates, std::vector<filteredBoxes> &filtBoxes);
+
+    void nmsWithoutSoftSigma(const float *boxes, const SizeVector &boxesStrides,
+                             std::vector<candidateBoxes> &candidates, std::vector<filteredBoxes> &filtBoxes);
 
 private:
     // input
@@ -91,6 +94,9 @@ private:
 
     std::string errorPrefix;
 
+    // Converts the box to the y1, x1, y2, x2 format with y1 <= y2 and x1 <= x2
+    void toCorner(const float *box, float *corner) const;
+
     std::vector<std::vector<size_t>> numFiltBox;
     const std::string inType = "input", outType = "output";
 
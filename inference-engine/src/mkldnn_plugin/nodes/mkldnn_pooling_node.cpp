@@ -38,6 +38,7 @@ MKLDNNPoolingNode::MKLDNNPoolingNode(const std::shared_ptr<ngraph::Node>& op, co
         for (int i = 0; i < maxPoolOp->get_pads_end().size(); i++) {
             data_pad_end.push_back(static_cast<ptrdiff_t>(maxPoolOp->get_pads_end()[i]));
         }
+        autoPadding = maxPoolOp->get_auto_pad() == ngraph::op::PadType::SAME_UPPER || maxPoolOp->get_auto_pad() == ngraph::op::PadType::SAME_LOWER;
     } else if (avgPoolOp) {
         algorithm = PoolingAvg;
         exclude_pad = avgPoolOp->get_exclude_pad();
@@ -54,6 +55,7 @@ MKLDNNPoolingNode::MKLDNNPoolingNode(const std::shared_ptr<ngraph::Node>& op, co
         for (int i = 0; i < avgPoolOp->get_pads_end().size(); i++) {
             data_pad_end.push_back(static_cast<ptrdiff_t>(avgPoolOp->get_pads_end()[i]));
         }
+        autoPadding = avgPoolOp->get_auto_pad() == ngraph::op::PadType::SAME_UPPER || avgPoolOp->get_auto_pad() == ngraph::op::PadType::SAME_LOWER;
     } else {
         IE_THROW(NotImplemented)
                 << "CPU Pooling node doesn't support ngraph operation " << op->get_type_name() << " with name " << op->get_friendly_name();
@@ -110,21 +112,13 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
 
     effective_pad_begin = data_pad_begin;
-    effective_pad_end.resize(data_pad_end.size());
 
     auto parentDims = getParentEdgeAt(0)->getDims();
     auto childDims = getChildEdgeAt(0)->getDims();
     if ((parentDims.ndims() < 4) || (parentDims.ndims() > 5))
         IE_THROW() << "Pooling layer. Unsupported mode. Only 4D and 5D blobs are supported as input.";
 
-    for (int i = 0; i < effective_pad_end.size(); i++) {
-        int krn = kernel[i];
-        int src = getParentEdgeAt(0)->getDims()[2 + i];
-        int dst = getChildEdgeAt(0)->getDims()[2 + i];
-
-        int calc_dst = (src - krn + data_pad_begin[i]) / stride[i] + 1;
-        effective_pad_end[i] = (dst - calc_dst) * stride[i];
-    }
+    initEffectivePadEnd(parentDims, childDims);
     if (inputPrecision == Precision::I8 || inputPrecision == Precision::U8) {
         //  We have to extend i8i8_pooling_fwd_t from oneDNN to support BF16 output data type
         if (outputDataType == memory::data_type::bf16)
@@ -152,16 +146,34 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     }
 }
 
-void MKLDNNPoolingNode::createPrimitive() {
-    if (prim)
-        return;
+void MKLDNNPoolingNode::initEffectivePadEnd(const MKLDNNDims& inputDims, const MKLDNNDims& outputDims) {
+    effective_pad_end.resize(data_pad_end.size());
+    for (int i = 0; i < effective_pad_end.size(); i++) {
+        int krn = kernel[i];
+        int src = inputDims[2 + i];
+        int dst = outputDims[2 + i];
 
-    mkldnn::primitive_attr attr;
-    setPostOps(attr, true);
+        int calc_dst = (src - krn + data_pad_begin[i]) / stride[i] + 1;
+        effective_pad_end[i] = (dst - calc_dst) * stride[i];
+    }
+}
 
-    auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
+void MKLDNNPoolingNode::reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims) {
+    // the rounding of the output shape is expressed by the end paddings, they are recomputed for the new shape
+    initEffectivePadEnd(newInputDims[0], newOutputDims[0]);
+    MKLDNNNode::reshape(newInputDims, newOutputDims);
+}
+
+void MKLDNNPoolingNode::createPrimitive() {
+    // the primitive is set if it was created for the same shapes before, see MKLDNNNode::reshape()
+    if (!prim) {
+        mkldnn::primitive_attr attr;
+        setPostOps(attr, true);
 
-    prim.reset(new pooling_forward(prim_desc));
+        auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
+
+        prim.reset(new pooling_forward(prim_desc));
+    }
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
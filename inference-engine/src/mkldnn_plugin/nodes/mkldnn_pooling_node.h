@@ -27,11 +27,17 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canBeReshaped() const override {
+        return !autoPadding;
+    }
+    void reshape(const std::vector<MKLDNNDims>& newInputDims, const std::vector<MKLDNNDims>& newOutputDims) override;
 
 private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
+    void initEffectivePadEnd(const MKLDNNDims& inputDims, const MKLDNNDims& outputDims);
 
     bool exclude_pad = false;
+    bool autoPadding = false;
     std::vector<ptrdiff_t> stride;
     std::vector<ptrdiff_t> kernel;
 
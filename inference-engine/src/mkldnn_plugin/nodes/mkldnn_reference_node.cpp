@@ -14,7 +14,7 @@ using namespace InferenceEngine::details;
 
 MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache,
                                          const std::string& errorMessage) :
-        MKLDNNNode(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage) {
+        MKLDNNNode(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage), originalType(op->get_type_name()) {
     if (!op->has_evaluate()) {
         IE_THROW(NotImplemented) << "Cannot fallback on ngraph reference implementation (Ngraph::Node::evaluate() is not implemented)";
     }
@@ -59,19 +59,27 @@ void MKLDNNReferenceNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNReferenceNode::createPrimitive() {}
 
 void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
-    ngraph::HostTensorVector inputs;
+    inputTensors.resize(inDims.size());
+    inputPtrs.resize(inDims.size(), nullptr);
     for (size_t i = 0; i < inDims.size(); i++) {
         void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
-        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i), srcDataPtr));
+        if (srcDataPtr != inputPtrs[i]) {
+            inputTensors[i] = std::make_shared<ngraph::HostTensor>(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i), srcDataPtr);
+            inputPtrs[i] = srcDataPtr;
+        }
     }
 
-    ngraph::HostTensorVector outputs;
+    outputTensors.resize(outDims.size());
+    outputPtrs.resize(outDims.size(), nullptr);
     for (size_t i = 0; i < outDims.size(); i++) {
         void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
-        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i), dstDataPtr));
+        if (dstDataPtr != outputPtrs[i]) {
+            outputTensors[i] = std::make_shared<ngraph::HostTensor>(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i), dstDataPtr);
+            outputPtrs[i] = dstDataPtr;
+        }
     }
 
-    if (!ngraphOp->evaluate(outputs, inputs)) {
+    if (!ngraphOp->evaluate(outputTensors, inputTensors)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
 }
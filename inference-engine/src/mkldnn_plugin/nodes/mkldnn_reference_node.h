@@ -6,7 +6,9 @@
 
 //#include <ie_common.h>
 #include <mkldnn_node.h>
-//#include <string>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -20,9 +22,18 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    const std::string& getOriginalType() const { return originalType; }
+
 private:
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+    const std::string originalType;
+
+    // the wrappers are recreated only when the edge memory is reallocated
+    ngraph::HostTensorVector inputTensors;
+    ngraph::HostTensorVector outputTensors;
+    std::vector<void*> inputPtrs;
+    std::vector<void*> outputPtrs;
 };
 
 }  // namespace MKLDNNPlugin
@@ -82,6 +82,9 @@ void MKLDNNReorderNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
 
+    // the primitive is recreated when the graph is reshaped, so the implementation is chosen anew
+    canUseOptimizedNspc2Ncsp = false;
+    canUseOptimizedNcsp2Nspc = false;
     if (!isOptimized) {
         if (MKLDNNPlugin::one_of(getParentEdgeAt(0)->getDims().ndims(), 4, 5) &&
                 getParentEdgeAt(0)->getDims()[1] <= 64 &&
@@ -101,6 +104,9 @@ void MKLDNNReorderNode::createPrimitive() {
                    MKLDNNExtensionUtils::sizeOfDataType(getParentEdgeAt(0)->getMemory().GetDataType()) == 1) {
             // oneDNN doesn't provide JIT reorder impl for non-avx2 targets so we fallback on simple c++ implementation which shows better perf
             canUseOptimizedNcsp2Nspc = true;
+        } else if (prim) {
+            // the primitive was created for the same shapes before, see MKLDNNNode::reshape()
+            primArgs = {{DNNL_ARG_SRC, srcMemPtr->GetPrimitive()}, {DNNL_ARG_DST, dstMemPtr->GetPrimitive()}};
         } else {
             createReorderPrimitive(srcMemPtr->GetDescriptor(), srcMemPtr->GetPrimitive().get_data_handle(),
                                    dstMemPtr->GetDescriptor(), dstMemPtr->GetPrimitive().get_data_handle());
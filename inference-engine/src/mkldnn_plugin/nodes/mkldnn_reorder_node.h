@@ -22,6 +22,9 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
 
     void setDescs(const InferenceEngine::TensorDesc& input, const InferenceEngine::TensorDesc& output) {
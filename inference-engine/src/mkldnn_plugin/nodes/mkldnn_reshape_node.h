@@ -20,6 +20,9 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
 };
 
 }  // namespace MKLDNNPlugin
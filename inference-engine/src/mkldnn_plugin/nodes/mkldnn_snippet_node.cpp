@@ -0,0 +1,253 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+// minimal number of the innermost elements processed by one kernel call
+constexpr size_t minBlockSize = 256;
+
+} // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto subgraph = ngraph::as_type_ptr<const ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_ARGS) {
+            errorMessage = "Doesn't support more than " + std::to_string(SNIPPETS_MAX_ARGS) + " inputs and outputs in total";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 inputs";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 outputs";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Subgraph node with name '" + op->get_friendly_name() + "'";
+
+    // the body is reshaped during the code generation, so the snippet is copied to keep the original graph untouched
+    const auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    ngraph::OutputVector inputs;
+    for (const auto& input : op->input_values())
+        inputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_shape()));
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(inputs, ngraph::clone_function(*original->get_body()));
+    snippet->set_friendly_name(op->get_friendly_name());
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType;
+    if (mayiuse(avx512_common)) {
+        hostIsa = avx512_common;
+        implType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        hostIsa = avx2;
+        implType = impl_desc_type::jit_avx2;
+    } else if (mayiuse(sse41)) {
+        hostIsa = sse41;
+        implType = impl_desc_type::jit_sse42;
+    } else {
+        IE_THROW() << errorPrefix << " requires at least SSE4.1 support";
+    }
+
+    std::vector<DataConfigurator> inDataConf(getOriginalInputsNumber(), {TensorDescCreatorTypes::ncsp, Precision::FP32});
+    std::vector<DataConfigurator> outDataConf(getOriginalOutputsNumber(), {TensorDescCreatorTypes::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inDataConf, outDataConf, implType);
+}
+
+void MKLDNNSnippetNode::normalizeShapes() {
+    size_t rank = 4;
+    for (const auto& dims : inDims)
+        rank = std::max(rank, static_cast<size_t>(dims.ndims()));
+    for (const auto& dims : outDims)
+        rank = std::max(rank, static_cast<size_t>(dims.ndims()));
+
+    auto pad = [rank](const SizeVector& dims) {
+        std::vector<size_t> shape(rank - dims.size(), 1);
+        shape.insert(shape.end(), dims.begin(), dims.end());
+        return shape;
+    };
+
+    inShapes.clear();
+    outShapes.clear();
+    for (const auto& dims : inDims)
+        inShapes.push_back(pad(dims.ToSizeVector()));
+    for (const auto& dims : outDims)
+        outShapes.push_back(pad(dims.ToSizeVector()));
+
+    masterShape.assign(rank, 1);
+    for (const auto* shapes : {&inShapes, &outShapes}) {
+        for (const auto& shape : *shapes) {
+            for (size_t d = 0; d < rank; d++) {
+                if (shape[d] != 1)
+                    masterShape[d] = shape[d];
+            }
+        }
+    }
+
+    // two innermost dimensions can be merged if the tensor either matches the master shape or is broadcasted along both of them
+    auto canCollapse = [&](const std::vector<size_t>& shape) {
+        return (shape[rank - 1] == masterShape[rank - 1] && shape[rank - 2] == masterShape[rank - 2]) ||
+               (shape[rank - 1] == 1 && shape[rank - 2] == 1);
+    };
+    auto collapse = [rank](std::vector<size_t>& shape) {
+        shape[rank - 1] *= shape[rank - 2];
+        for (size_t d = rank - 2; d > 0; d--)
+            shape[d] = shape[d - 1];
+        shape[0] = 1;
+    };
+
+    for (size_t step = 0; step < rank - 1; step++) {
+        bool collapsible = true;
+        for (const auto* shapes : {&inShapes, &outShapes}) {
+            for (const auto& shape : *shapes)
+                collapsible = collapsible && canCollapse(shape);
+        }
+        if (!collapsible)
+            break;
+
+        for (auto* shapes : {&inShapes, &outShapes}) {
+            for (auto& shape : *shapes)
+                collapse(shape);
+        }
+        collapse(masterShape);
+    }
+}
+
+void MKLDNNSnippetNode::calcStrides() {
+    auto strides = [](const std::vector<size_t>& shape) {
+        std::vector<size_t> result(shape.size(), 0);
+        size_t stride = 1;
+        for (int d = static_cast<int>(shape.size()) - 1; d >= 0; d--) {
+            result[d] = shape[d] == 1 ? 0 : stride;
+            stride *= shape[d];
+        }
+        return result;
+    };
+
+    inStrides.clear();
+    outStrides.clear();
+    for (const auto& shape : inShapes)
+        inStrides.push_back(strides(shape));
+    for (const auto& shape : outShapes)
+        outStrides.push_back(strides(shape));
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    normalizeShapes();
+    calcStrides();
+
+    ngraph::AxisVector order(masterShape.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inBlockedShapes, outBlockedShapes;
+    for (const auto& shape : inShapes)
+        inBlockedShapes.emplace_back(ngraph::Shape(shape), order, ngraph::element::f32);
+    for (const auto& shape : outShapes)
+        outBlockedShapes.emplace_back(ngraph::Shape(shape), order, ngraph::element::f32);
+
+    snippet->set_generator(std::make_shared<CPUGenerator>(hostIsa));
+    schedule = snippet->generate(outBlockedShapes, inBlockedShapes);
+    if (schedule.ptr == nullptr)
+        IE_THROW() << errorPrefix << " failed to generate the kernel";
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t rank = masterShape.size();
+    const size_t innerDim = masterShape.back();
+    const size_t outerWork = std::accumulate(masterShape.begin(), masterShape.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    // the innermost dimension is split as well if there are not enough outer iterations to load all the threads
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    size_t blockSize = innerDim;
+    if (outerWork < nthr) {
+        const size_t blocksPerRow = div_up(nthr, outerWork);
+        blockSize = std::min(innerDim, std::max(minBlockSize, rnd_up(div_up(innerDim, blocksPerRow), 16)));
+    }
+    const size_t blocksNum = div_up(innerDim, blockSize);
+
+    const size_t inputsNum = inShapes.size();
+    const size_t outputsNum = outShapes.size();
+    std::vector<const uint8_t*> srcPtrs(inputsNum);
+    std::vector<uint8_t*> dstPtrs(outputsNum);
+    for (size_t i = 0; i < inputsNum; i++)
+        srcPtrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgesAtPort(i)[0]->getMemory().GetPtr());
+    for (size_t i = 0; i < outputsNum; i++)
+        dstPtrs[i] = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemory().GetPtr());
+
+    const auto kernel = schedule.get_callable<void(*)(const jit_snippets_call_args*)>();
+
+    parallel_for2d(outerWork, blocksNum, [&](size_t outer, size_t block) {
+        size_t inOffsets[SNIPPETS_MAX_ARGS] = {0};
+        size_t outOffsets[SNIPPETS_MAX_ARGS] = {0};
+
+        size_t rest = outer;
+        for (int d = static_cast<int>(rank) - 2; d >= 0; d--) {
+            const size_t idx = rest % masterShape[d];
+            rest /= masterShape[d];
+            for (size_t i = 0; i < inputsNum; i++)
+                inOffsets[i] += idx * inStrides[i][d];
+            for (size_t i = 0; i < outputsNum; i++)
+                outOffsets[i] += idx * outStrides[i][d];
+        }
+
+        const size_t start = block * blockSize;
+        jit_snippets_call_args args;
+        for (size_t i = 0; i < inputsNum; i++)
+            args.src_ptrs[i] = srcPtrs[i] + (inOffsets[i] + start * inStrides[i][rank - 1]) * sizeof(float);
+        for (size_t i = 0; i < outputsNum; i++)
+            args.dst_ptrs[i] = dstPtrs[i] + (outOffsets[i] + start * outStrides[i][rank - 1]) * sizeof(float);
+        args.work_amount = std::min(blockSize, innerDim - start);
+
+        kernel(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph)
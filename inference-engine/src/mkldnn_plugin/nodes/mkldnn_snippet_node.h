@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode executes a subgraph of elementwise operations collapsed by the snippets tokenizer
+/// as a single JIT kernel generated for the actual input/output shapes
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // collapses the trailing dimensions which have the same broadcast pattern for all the tensors
+    void normalizeShapes();
+    void calcStrides();
+
+    // copy of the original snippet detached from the graph, it's mutated by the code generation
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+    mkldnn::impl::cpu::x64::cpu_isa_t hostIsa = mkldnn::impl::cpu::x64::isa_any;
+
+    // normalized shapes of the same rank: all the dimensions except the innermost one are scheduled by the node
+    std::vector<std::vector<size_t>> inShapes;
+    std::vector<std::vector<size_t>> outShapes;
+    std::vector<size_t> masterShape;
+    // strides in elements, zero for the broadcasted dimensions
+    std::vector<std::vector<size_t>> inStrides;
+    std::vector<std::vector<size_t>> outStrides;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -54,34 +54,34 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
 }
 
 void MKLDNNSoftMaxNode::createPrimitive() {
-    if (prim)
-        return;
-
-    memory::desc in_candidate = getParentEdgeAt(0)->getMemory().GetDescriptor();
-    MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
-            new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
-    descs[0] = desc;
-    std::shared_ptr<softmax_forward::desc> selected_desc_ptr = descs[0];
-
-    const PrimitiveDescInfo *selected_pd = getSelectedPrimitiveDescriptor();
-    if (selected_pd == nullptr)
-        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
-
-    auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, getEngine());
-    primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-
-    while (itpd) {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
-        auto primitiveDescriptor = getSelectedPrimitiveDescriptor();
-        if ((primitiveDescriptor != nullptr) && (impl_type == primitiveDescriptor->getImplementationType())) {
-            prim_desc = itpd.get();
-            break;
+    // the primitive is set if it was created for the same shapes before, see MKLDNNNode::reshape()
+    if (!prim) {
+        memory::desc in_candidate = getParentEdgeAt(0)->getMemory().GetDescriptor();
+        MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
+                new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
+        descs[0] = desc;
+        std::shared_ptr<softmax_forward::desc> selected_desc_ptr = descs[0];
+
+        const PrimitiveDescInfo *selected_pd = getSelectedPrimitiveDescriptor();
+        if (selected_pd == nullptr)
+            IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+
+        auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, getEngine());
+        primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+
+        while (itpd) {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+            auto primitiveDescriptor = getSelectedPrimitiveDescriptor();
+            if ((primitiveDescriptor != nullptr) && (impl_type == primitiveDescriptor->getImplementationType())) {
+                prim_desc = itpd.get();
+                break;
+            }
+            if (!itpd.next_impl())
+                break;
         }
-        if (!itpd.next_impl())
-            break;
-    }
 
-    prim.reset(new softmax_forward(prim_desc));
+        prim.reset(new softmax_forward(prim_desc));
+    }
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -22,6 +22,9 @@ public:
     void getSupportedDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    bool canBeReshaped() const override {
+        return true;
+    }
 
 private:
     size_t axis = 0;
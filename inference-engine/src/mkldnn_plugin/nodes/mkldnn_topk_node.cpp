@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <ngraph/op/topk.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_topk_node.h"
+#include "utils/bfloat16.hpp"
 #include "utils/general_utils.h"
+#include <mkldnn_selective_build.h>
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -84,27 +89,133 @@ void MKLDNNTopKNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // the values are ranked in the original precision, other precisions are converted to FP32
+    dataPrecision = getOriginalInputPrecisionAtPort(TOPK_DATA);
+    if (!one_of(dataPrecision, Precision::FP32, Precision::BF16, Precision::I32, Precision::I8, Precision::U8))
+        dataPrecision = Precision::FP32;
+
     std::vector<DataConfigurator> outDataConf;
     outDataConf.reserve(getOriginalOutputsNumber());
-    outDataConf.emplace_back(TensorDescCreatorTypes::ncsp, Precision::FP32);
+    outDataConf.emplace_back(TensorDescCreatorTypes::ncsp, dataPrecision);
     for (int i = 1; i < getOriginalOutputsNumber(); ++i)
         outDataConf.emplace_back(TensorDescCreatorTypes::ncsp, Precision::I32);
 
-    addSupportedPrimDesc({{TensorDescCreatorTypes::ncsp, Precision::FP32},
+    addSupportedPrimDesc({{TensorDescCreatorTypes::ncsp, dataPrecision},
                           {TensorDescCreatorTypes::ncsp, Precision::I32}},
                          outDataConf,
                          impl_desc_type::ref_any);
 }
 
+namespace {
+
+struct TopKContext {
+    MKLDNNTopKNode &node;
+    const uint8_t *src;
+    uint8_t *dst_data;
+    int *dst_idx;
+    const SizeVector &in_dims;
+};
+
+}   // namespace
+
+template<typename T>
+struct MKLDNNTopKNode::TopKExecute {
+    void operator()(TopKContext & ctx) {
+        ctx.node.executeImpl<T>(reinterpret_cast<const T *>(ctx.src), reinterpret_cast<T *>(ctx.dst_data), ctx.dst_idx, ctx.in_dims);
+    }
+};
+
+inline int MKLDNNTopKNode::getAxisSplitsNum(const SizeVector& in_dims) {
+    const int rows = before_num * count(in_dims, axis + 1, in_dims.size());
+    const int nthr = parallel_get_max_threads();
+    if (rows >= nthr)
+        return 1;
+    const int min_chunk = std::max(src_k, split_min_chunk);
+    return std::max(1, std::min(nthr / rows, dim / min_chunk));
+}
+
+inline bool MKLDNNTopKNode::usePartialSort(const SizeVector& in_dims) {
+    return src_k >= partial_sort_min_k || getAxisSplitsNum(in_dims) > 1;
+}
+
+template <typename T>
+void MKLDNNTopKNode::executeImpl(const T* src, T* dst_data, int* dst_idx, SizeVector in_dims) {
+    if (usePartialSort(in_dims)) {
+        if (mode_max)
+            topk_partial_sort<T, std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            topk_partial_sort<T, std::less>(src, dst_data, dst_idx, in_dims);
+    } else if (src_k == 1) {
+        if (is_last_dim) {
+            if (mode_max)
+                top1<T, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                top1<T, std::less>(src, dst_data, dst_idx, in_dims);
+        } else {
+            if (mode_max)
+                top1_axis_ref<T, std::greater>(src, dst_data, dst_idx, in_dims, 0);
+            else
+                top1_axis_ref<T, std::less>(src, dst_data, dst_idx, in_dims, 0);
+        }
+    } else {
+        if (is_last_dim) {
+            if (mode_max)
+                topk<T, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk<T, std::less>(src, dst_data, dst_idx, in_dims);
+        } else {
+            if (mode_max)
+                topk_axis_ref<T, std::greater>(src, dst_data, dst_idx, in_dims, 0);
+            else
+                topk_axis_ref<T, std::less>(src, dst_data, dst_idx, in_dims, 0);
+        }
+    }
+}
+
+// FP32 data along the inner axes is ranked by the vector kernels
+template <>
+void MKLDNNTopKNode::executeImpl<float>(const float* src, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    if (usePartialSort(in_dims)) {
+        if (mode_max)
+            topk_partial_sort<float, std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            topk_partial_sort<float, std::less>(src, dst_data, dst_idx, in_dims);
+    } else if (src_k == 1) {
+        if (is_last_dim) {
+            if (mode_max)
+                top1<float, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                top1<float, std::less>(src, dst_data, dst_idx, in_dims);
+        } else {
+            if (mode_max)
+                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+        }
+    } else {
+        if (is_last_dim) {
+            if (mode_max)
+                topk<float, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk<float, std::less>(src, dst_data, dst_idx, in_dims);
+        } else {
+            if (mode_max)
+                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+        }
+    }
+}
+
 void MKLDNNTopKNode::execute(mkldnn::stream strm) {
-    const float *src = reinterpret_cast<const float *>(getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr());
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr());
     src_k = reinterpret_cast<int *>(getParentEdgeAt(TOPK_K)->getMemoryPtr()->GetPtr())[0];
-    float* dst_data = nullptr;
+    uint8_t* dst_data = nullptr;
     int* dst_idx = nullptr;
 
     if (outDims.size() == 1) {
-        if (getOriginalOutputPrecisionAtPort(0) == Precision::FP32) {
-            dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+        if (!one_of(getOriginalOutputPrecisionAtPort(0), Precision::I32, Precision::I64) || dataPrecision == Precision::I32) {
+            dst_data = reinterpret_cast<uint8_t *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
         } else {
             dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
         }
@@ -115,7 +226,7 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
             IE_THROW() << errorMsg;
         }
     } else if (outDims.size() == 2) {
-        dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr());
+        dst_data = reinterpret_cast<uint8_t *>(getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr());
         SizeVector dst_data_dims = getChildEdgesAtPort(TOPK_VALUE)[0]->getDims().ToSizeVector();
 
         dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(TOPK_INDEX)[0]->getMemoryPtr()->GetPtr());
@@ -132,34 +243,25 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
 
     if (src_dims[axis] < static_cast<size_t>(src_k))
         src_k = src_dims[axis];
+    if (src_k <= 0)
+        return;
 
     SizeVector in_dims = getParentEdgeAt(TOPK_DATA)->getDims().ToSizeVector();
 
-    if (src_k == 1) {
-        if (is_last_dim) {
-            if (mode_max)
-                top1<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
-    } else {
-        if (is_last_dim) {
-            if (mode_max)
-                topk<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
-    }
+    TopKContext ctx = {
+        *this,
+        src,
+        dst_data,
+        dst_idx,
+        in_dims
+    };
+
+    OV_SWITCH(MKLDNNPlugin, TopKExecute, ctx, dataPrecision,
+              OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t),
+              OV_CASE(Precision::I32, int32_t),
+              OV_CASE(Precision::I8, int8_t),
+              OV_CASE(Precision::U8, uint8_t));
 }
 
 bool MKLDNNTopKNode::created() const {
@@ -196,14 +298,20 @@ void MKLDNNTopKNode::top1_axis(const float* src_data, float* dst_data, int* dst_
         });
         first_index = after_num / block_size * block_size;
 #endif
+    top1_axis_ref<float, Compare2>(src_data, dst_data, dst_idx, in_dims, first_index);
+}
+
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::top1_axis_ref(const T* src_data, T* dst_data, int* dst_idx, SizeVector in_dims, int first_index) {
+    int after_num = count(in_dims, axis + 1, in_dims.size());
     int rest = after_num - first_index;
     parallel_for2d(before_num, rest, [&](int i0, int i1) {
         int index_max_val = 0;
         int s_index = i0 * dim * after_num + first_index + i1;
-        float max_val = src_data[s_index];
+        T max_val = src_data[s_index];
         for (int i2 = 1; i2 < dim; i2++) {
             s_index += after_num;
-            if (Compare2<float>()(src_data[s_index], max_val)) {
+            if (Compare<T>()(src_data[s_index], max_val)) {
                 max_val = src_data[s_index];
                 index_max_val = i2;
             }
@@ -215,15 +323,15 @@ void MKLDNNTopKNode::top1_axis(const float* src_data, float* dst_data, int* dst_
     });
 }
 
-template <template <typename> class Compare>
-void MKLDNNTopKNode::top1(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::top1(const T* src_data, T* dst_data, int* dst_idx, SizeVector in_dims) {
     parallel_for(before_num, [&](int i0) {
         int index_max_val = 0;
         int s_index = i0 * dim;
-        float max_val = src_data[s_index];
+        T max_val = src_data[s_index];
         for (int i1 = 1; i1 < dim; i1++) {
             s_index++;
-            if (Compare<float>()(src_data[s_index], max_val)) {
+            if (Compare<T>()(src_data[s_index], max_val)) {
                 max_val = src_data[s_index];
                 index_max_val = i1;
             }
@@ -341,11 +449,17 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
             first_index = after_num / block_size * block_size;
         }
 #endif
+    topk_axis_ref<float, Compare2>(src_data, dst_data, dst_idx, in_dims, first_index);
+}
+
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::topk_axis_ref(const T* src_data, T* dst_data, int* dst_idx, SizeVector in_dims, int first_index) {
+    int after_num = count(in_dims, axis + 1, in_dims.size());
     int rest = after_num - first_index;
     parallel_for2d(before_num, rest, [&](int i0, int i1) {
-        std::vector<float> max_values(src_k + 1);
+        std::vector<T> max_values(src_k + 1);
         std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
+        T tmp_value;
         int tmp_index;
         int s_index = i0 * dim * after_num + first_index + i1;
 
@@ -366,7 +480,7 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
         }
         for (int i2 = 0; i2 < src_k - 1; i2++) {
             for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1])) {
+                if (Compare<T>()(max_values[i3], max_values[i3 - 1])) {
                     swap_func(i3, i3 - 1);
                 }
             }
@@ -375,7 +489,7 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
             max_values[src_k] = src_data[s_index];
             max_indexes[src_k] = i2;
             for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1]))
+                if (Compare<T>()(max_values[i3], max_values[i3 - 1]))
                     swap_func(i3, i3 - 1);
                 else
                     break;
@@ -402,12 +516,12 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
     });
 }
 
-template <template <typename> class Compare>
-void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::topk(const T* src_data, T* dst_data, int* dst_idx, SizeVector in_dims) {
     parallel_for(before_num, [&](int i0) {
-        std::vector<float> max_values(src_k + 1);
+        std::vector<T> max_values(src_k + 1);
         std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
+        T tmp_value;
         int tmp_index;
         int s_index = i0 * dim;
 
@@ -428,7 +542,7 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
         }
         for (int i2 = 0; i2 < src_k - 1; i2++) {
             for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1])) {
+                if (Compare<T>()(max_values[i3], max_values[i3 - 1])) {
                     swap_func(i3, i3 - 1);
                 }
             }
@@ -437,7 +551,7 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
             max_values[src_k] = src_data[s_index];
             max_indexes[src_k] = i2;
             for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1]))
+                if (Compare<T>()(max_values[i3], max_values[i3 - 1]))
                     swap_func(i3, i3 - 1);
                 else
                     break;
@@ -464,6 +578,116 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+namespace {
+
+template <typename T>
+using ValueIndex = std::pair<T, int>;
+
+// Strict total order of the elements: by value according to Compare, among equal values the lower index goes first.
+// NaNs are ranked after all the other values, so the order stays valid for std::nth_element and std::sort.
+template <typename T, template <typename> class Compare>
+struct ValueIndexCompare {
+    bool operator()(const ValueIndex<T>& a, const ValueIndex<T>& b) const {
+        const bool a_nan = isNaN(a.first), b_nan = isNaN(b.first);
+        if (a_nan || b_nan)
+            return a_nan == b_nan ? a.second < b.second : b_nan;
+        if (Compare<T>()(a.first, b.first))
+            return true;
+        if (Compare<T>()(b.first, a.first))
+            return false;
+        return a.second < b.second;
+    }
+
+    template <typename V>
+    static bool isNaN(const V& value) {
+        return value != value;
+    }
+};
+
+// Moves the best k elements to the front in O(n) on average, the rest of the elements are left unordered
+template <typename T, template <typename> class Compare>
+void selectTopK(std::vector<ValueIndex<T>>& elements, size_t k) {
+    if (k < elements.size())
+        std::nth_element(elements.begin(), elements.begin() + k - 1, elements.end(), ValueIndexCompare<T, Compare>());
+}
+
+// Orders the first k elements either by value or by index
+template <typename T, template <typename> class Compare>
+void sortTopK(std::vector<ValueIndex<T>>& elements, size_t k, bool sort_value) {
+    if (sort_value) {
+        std::sort(elements.begin(), elements.begin() + k, ValueIndexCompare<T, Compare>());
+    } else {
+        std::sort(elements.begin(), elements.begin() + k, [](const ValueIndex<T>& a, const ValueIndex<T>& b) {
+            return a.second < b.second;
+        });
+    }
+}
+
+}   // namespace
+
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::topk_partial_sort(const T* src_data, T* dst_data, int* dst_idx, SizeVector in_dims) {
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    const int rows = before_num * after_num;
+    const int splits = getAxisSplitsNum(in_dims);
+    const int chunk = div_up(dim, splits);
+
+    auto gather = [&](int row, int begin, int end, std::vector<ValueIndex<T>>& elements) {
+        const T* src = src_data + (row / after_num) * dim * after_num + row % after_num;
+        elements.resize(end - begin);
+        for (int i = begin; i < end; i++)
+            elements[i - begin] = ValueIndex<T>(src[i * after_num], i);
+    };
+    auto store = [&](int row, const std::vector<ValueIndex<T>>& elements) {
+        const int offset = (row / after_num) * src_k * after_num + row % after_num;
+        for (int i = 0; i < src_k; i++) {
+            if (dst_data)
+                dst_data[offset + i * after_num] = elements[i].first;
+            if (dst_idx)
+                dst_idx[offset + i * after_num] = elements[i].second;
+        }
+    };
+
+    if (splits == 1) {
+        parallel_for(rows, [&](int row) {
+            std::vector<ValueIndex<T>> elements;
+            gather(row, 0, dim, elements);
+            selectTopK<T, Compare>(elements, src_k);
+            sortTopK<T, Compare>(elements, src_k, sort_value);
+            store(row, elements);
+        });
+        return;
+    }
+
+    // Split: every part of the axis contributes its own top k candidates, which are merged then.
+    // The order of the elements is total, so the result doesn't depend on the number of the parts.
+    std::vector<ValueIndex<T>> candidates(static_cast<size_t>(rows) * splits * src_k);
+    std::vector<int> candidates_num(static_cast<size_t>(rows) * splits, 0);
+    parallel_for2d(rows, splits, [&](int row, int part) {
+        const int begin = part * chunk;
+        const int end = std::min(dim, begin + chunk);
+        if (begin >= end)
+            return;
+        std::vector<ValueIndex<T>> elements;
+        gather(row, begin, end, elements);
+        const int k = std::min(src_k, end - begin);
+        selectTopK<T, Compare>(elements, k);
+        std::copy(elements.begin(), elements.begin() + k, candidates.begin() + (static_cast<size_t>(row) * splits + part) * src_k);
+        candidates_num[row * splits + part] = k;
+    });
+    parallel_for(rows, [&](int row) {
+        std::vector<ValueIndex<T>> elements;
+        elements.reserve(splits * src_k);
+        for (int part = 0; part < splits; part++) {
+            auto first = candidates.begin() + (static_cast<size_t>(row) * splits + part) * src_k;
+            elements.insert(elements.end(), first, first + candidates_num[row * splits + part]);
+        }
+        selectTopK<T, Compare>(elements, src_k);
+        sortTopK<T, Compare>(elements, src_k, sort_value);
+        store(row, elements);
+    });
+}
+
 inline int MKLDNNTopKNode::count(SizeVector dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
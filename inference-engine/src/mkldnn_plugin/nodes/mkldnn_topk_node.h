@@ -70,14 +70,23 @@ public:
     template<class Compare1, template<typename> class Compare2>
     void top1_axis(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
-    template<template<typename> class Compare>
-    void top1(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+    template<typename T, template<typename> class Compare>
+    void top1_axis_ref(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims, int first_index);
+
+    template<typename T, template<typename> class Compare>
+    void top1(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
     template<class Compare1, template<typename> class Compare2>
     void topk_axis(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
-    template<template<typename> class Compare>
-    void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+    template<typename T, template<typename> class Compare>
+    void topk_axis_ref(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims, int first_index);
+
+    template<typename T, template<typename> class Compare>
+    void topk(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+
+    template<typename T, template<typename> class Compare>
+    void topk_partial_sort(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
 private:
     const size_t TOPK_DATA = 0;
@@ -98,6 +107,24 @@ private:
 
     int dim, before_num;
 
+    InferenceEngine::Precision dataPrecision = InferenceEngine::Precision::FP32;
+
+    // the insertion based ranking costs O(dim * k), so starting from this k the partial sort is used
+    const int partial_sort_min_k = 32;
+    // the reduced axis is split between the threads when there are not enough rows to load all of them,
+    // but every thread gets at least this number of elements
+    const int split_min_chunk = 4096;
+
+    template<typename T>
+    struct TopKExecute;
+
+    template<typename T>
+    void executeImpl(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+
+    inline int getAxisSplitsNum(const InferenceEngine::SizeVector& in_dims);
+
+    inline bool usePartialSort(const InferenceEngine::SizeVector& in_dims);
+
     std::string errorPrefix;
 
 #if defined(HAVE_AVX512F)
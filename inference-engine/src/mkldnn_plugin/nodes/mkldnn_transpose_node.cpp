@@ -141,6 +141,10 @@ void MKLDNNTransposeNode::createPrimitive() {
         return;
     }
 
+    const auto key = getShapesKey();
+    if (reshapedKernels.find(key, permuteKernel))
+        return;
+
     PermuteParams params;
     params.data_size = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision().size();
     params.order = order;
@@ -153,7 +157,18 @@ void MKLDNNTransposeNode::createPrimitive() {
     params.dst_block_dims = dstDesc.getBlockingDesc().getBlockDims();
     params.dst_block_order = dstDesc.getBlockingDesc().getOrder();
 
-    permuteKernel = std::unique_ptr<PermuteKernel>(new PermuteKernel(params));
+    permuteKernel = std::make_shared<PermuteKernel>(params);
+    reshapedKernels.put(key, permuteKernel);
+}
+
+bool MKLDNNTransposeNode::canBeReshaped() const {
+    // the blocked layouts are selected for the channels of the upper bound shape, the planar ones fit any shape
+    const auto* selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        return false;
+    const auto& config = selectedPD->getConfig();
+    return config.inConfs[0].desc.getBlockingDesc().getBlockDims().size() == config.inConfs[0].desc.getDims().size() &&
+           config.outConfs[0].desc.getBlockingDesc().getBlockDims().size() == config.outConfs[0].desc.getDims().size();
 }
 
 template <typename T>
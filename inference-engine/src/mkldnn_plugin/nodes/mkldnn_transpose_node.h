@@ -28,6 +28,7 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canBeReshaped() const override;
 
     const InferenceEngine::SizeVector& getOrder() const {
         return order;
@@ -46,7 +47,9 @@ private:
             std::vector<size_t>{0, 5, 1, 2, 3, 4},
     };
 
-    std::unique_ptr<PermuteKernel> permuteKernel;
+    std::shared_ptr<PermuteKernel> permuteKernel;
+    // The kernels generated for the shapes the node was reshaped to
+    MKLDNNShapeCache<std::shared_ptr<PermuteKernel>> reshapedKernels;
 
     struct TransposeContext {
         MKLDNNTransposeNode* nodePtr;
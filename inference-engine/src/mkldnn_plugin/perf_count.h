@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -12,14 +16,43 @@ class PerfCount {
     uint64_t duration;
     uint32_t num;
 
+    // durations (ns) of the latest iterations, stored only when the history is enabled
+    std::vector<uint64_t> history;
+    size_t historyPos = 0;
+    bool historyEnabled = false;
+
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
 public:
+    // the latency percentiles are computed over a bounded window of the latest iterations
+    static constexpr size_t maxHistorySize = 1024;
+
     PerfCount(): duration(0), num(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    void enableHistory() {
+        historyEnabled = true;
+        history.reserve(maxHistorySize);
+    }
+
+    bool hasHistory() const { return !history.empty(); }
+
+    /**
+     * @brief Returns the nearest-rank percentile of the recorded iteration durations in microseconds
+     * @param p percentile in the (0, 100] range
+     */
+    double percentile(double p) const {
+        if (history.empty())
+            return 0.0;
+        std::vector<uint64_t> sorted(history);
+        const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        const size_t idx = std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+        return sorted[idx] / 1000.0;
+    }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -30,6 +63,16 @@ private:
 
         duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+
+        if (historyEnabled) {
+            const uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+            if (history.size() < maxHistorySize) {
+                history.push_back(ns);
+            } else {
+                history[historyPos] = ns;
+                historyPos = (historyPos + 1) % maxHistorySize;
+            }
+        }
     }
 
     friend class PerfHelper;
@@ -0,0 +1,395 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "serialize.hpp"
+
+#include <ie_common.h>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph_ops/nms_ie_internal.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <snippets/op/subgraph.hpp>
+#include <transformations/serialize.hpp>
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
+#include "mkldnn_weights_cache.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+// Bump the version on any change of the blob layout, import of a blob with another version is rejected
+constexpr std::uint32_t exportFormatVersion = 3;
+
+// Operations created by the plugin transformations
+const std::map<std::string, ngraph::OpSet>& getPluginOpsets() {
+    static const std::map<std::string, ngraph::OpSet> opsets = [] {
+        ngraph::OpSet opset;
+        opset.insert<FullyConnectedNode>();
+        opset.insert<LeakyReluNode>();
+        opset.insert<PowerStaticNode>();
+        opset.insert<SwishNode>();
+        opset.insert<ngraph::op::internal::NonMaxSuppressionIEInternal>();
+        return std::map<std::string, ngraph::OpSet>{{"cpu_plugin_opset", opset}};
+    }();
+    return opsets;
+}
+
+class PluginOpsetsExtension : public IExtension {
+public:
+    void GetVersion(const Version*& versionInfo) const noexcept override {
+        static Version ExtensionDescription = {
+            { 2, 1 },    // extension API version
+            "2.1",
+            "cpu-plugin-opset"  // extension description message
+        };
+
+        versionInfo = &ExtensionDescription;
+    }
+
+    void Unload() noexcept override {}
+
+    std::map<std::string, ngraph::OpSet> getOpSets() override {
+        return getPluginOpsets();
+    }
+};
+
+void writeSize(std::ostream & stream, std::uint64_t size) {
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+}
+
+std::uint64_t readSize(std::istream & stream) {
+    std::uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin export blob";
+    return size;
+}
+
+// The counts are checked against the rest of the blob, so the corrupted one is rejected instead of huge allocations
+std::uint64_t readCount(std::istream & stream, std::uint64_t elementSize = sizeof(std::uint64_t)) {
+    const auto count = readSize(stream);
+    const auto current = stream.tellg();
+    if (current == std::istream::pos_type(-1))
+        return count;
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(current);
+    if (end != std::istream::pos_type(-1) && count > static_cast<std::uint64_t>(end - current) / elementSize)
+        IE_THROW(NetworkNotRead) << "Corrupted CPU plugin export blob";
+    return count;
+}
+
+void writeString(std::ostream & stream, const std::string & str) {
+    writeSize(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+void writeChecksum(std::ostream & stream, const void * data, std::size_t size) {
+    writeSize(stream, MKLDNNWeightsSharing::GetContentChecksum(data, size));
+}
+
+void checkChecksum(std::istream & stream, const void * data, std::size_t size) {
+    if (readSize(stream) != MKLDNNWeightsSharing::GetContentChecksum(data, size))
+        IE_THROW(NetworkNotRead) << "Corrupted CPU plugin export blob";
+}
+
+std::string readString(std::istream & stream) {
+    std::string str(readCount(stream, 1), '\0');
+    stream.read(&str[0], str.size());
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin export blob";
+    return str;
+}
+
+void writeSizes(std::ostream & stream, const SizeVector & sizes) {
+    writeSize(stream, sizes.size());
+    for (auto size : sizes)
+        writeSize(stream, size);
+}
+
+SizeVector readSizes(std::istream & stream) {
+    SizeVector sizes(readCount(stream));
+    for (auto & size : sizes)
+        size = readSize(stream);
+    return sizes;
+}
+
+void writeDataInfo(std::ostream & stream, const std::string & name, const DataPtr & data) {
+    writeString(stream, name);
+    writeString(stream, data->getPrecision().name());
+    writeSize(stream, static_cast<std::uint64_t>(data->getLayout()));
+}
+
+void writeTensorDesc(std::ostream & stream, const TensorDesc & desc) {
+    writeString(stream, desc.getPrecision().name());
+    writeSize(stream, static_cast<std::uint64_t>(desc.getLayout()));
+    writeSizes(stream, desc.getDims());
+    const auto & blocking = desc.getBlockingDesc();
+    writeSizes(stream, blocking.getBlockDims());
+    writeSizes(stream, blocking.getOrder());
+    writeSize(stream, blocking.getOffsetPadding());
+    writeSizes(stream, blocking.getOffsetPaddingToData());
+    writeSizes(stream, blocking.getStrides());
+}
+
+TensorDesc readTensorDesc(std::istream & stream) {
+    const auto precision = Precision::FromStr(readString(stream));
+    const auto layout = static_cast<Layout>(readSize(stream));
+    const auto dims = readSizes(stream);
+    const auto blockDims = readSizes(stream);
+    const auto order = readSizes(stream);
+    const auto offsetPadding = readSize(stream);
+    const auto offsetPaddingToData = readSizes(stream);
+    const auto strides = readSizes(stream);
+    if (layout == Layout::ANY)
+        return TensorDesc(precision, dims, layout);
+    return TensorDesc(precision, dims, BlockingDesc(blockDims, order, offsetPadding, offsetPaddingToData, strides));
+}
+
+void writePlan(std::ostream & stream, const MKLDNNGraphPlan & plan) {
+    writeSize(stream, plan.nodes.size());
+    for (const auto & node : plan.nodes) {
+        writeString(stream, node.name);
+        writeSize(stream, static_cast<std::uint64_t>(node.implType));
+        writeSize(stream, node.inDescs.size());
+        for (const auto & desc : node.inDescs)
+            writeTensorDesc(stream, desc);
+        writeSize(stream, node.outDescs.size());
+        for (const auto & desc : node.outDescs)
+            writeTensorDesc(stream, desc);
+        writeSize(stream, node.fusedWith.size());
+        for (const auto & fusedNode : node.fusedWith)
+            writeString(stream, fusedNode);
+    }
+
+    writeSize(stream, plan.memoryBoxes.size());
+    for (const auto & box : plan.memoryBoxes) {
+        writeSize(stream, static_cast<std::int64_t>(box.start));
+        writeSize(stream, static_cast<std::int64_t>(box.finish));
+        writeSize(stream, box.size);
+        writeSize(stream, box.id);
+    }
+    writeSize(stream, plan.memoryOffsets.size());
+    for (auto offset : plan.memoryOffsets)
+        writeSize(stream, offset);
+    writeSize(stream, plan.memorySize);
+
+    writeSize(stream, plan.constants.size());
+    for (const auto & constant : plan.constants) {
+        writeString(stream, constant.parent);
+        writeSize(stream, constant.parentPort);
+        writeString(stream, constant.child);
+        writeSize(stream, constant.childPort);
+        writeSize(stream, constant.data.size());
+        stream.write(reinterpret_cast<const char*>(constant.data.data()), constant.data.size());
+        writeChecksum(stream, constant.data.data(), constant.data.size());
+    }
+}
+
+MKLDNNGraphPlan::CPtr readPlan(std::istream & stream) {
+    auto plan = std::make_shared<MKLDNNGraphPlan>();
+
+    plan->nodes.resize(readCount(stream));
+    for (auto & node : plan->nodes) {
+        node.name = readString(stream);
+        node.implType = static_cast<impl_desc_type>(readSize(stream));
+        node.inDescs.resize(readCount(stream));
+        for (auto & desc : node.inDescs)
+            desc = readTensorDesc(stream);
+        node.outDescs.resize(readCount(stream));
+        for (auto & desc : node.outDescs)
+            desc = readTensorDesc(stream);
+        node.fusedWith.resize(readCount(stream));
+        for (auto & fusedNode : node.fusedWith)
+            fusedNode = readString(stream);
+    }
+
+    plan->memoryBoxes.resize(readCount(stream));
+    for (auto & box : plan->memoryBoxes) {
+        box.start = static_cast<int>(static_cast<std::int64_t>(readSize(stream)));
+        box.finish = static_cast<int>(static_cast<std::int64_t>(readSize(stream)));
+        box.size = static_cast<std::int64_t>(readSize(stream));
+        box.id = static_cast<std::int64_t>(readSize(stream));
+    }
+    plan->memoryOffsets.resize(readCount(stream));
+    for (auto & offset : plan->memoryOffsets)
+        offset = static_cast<std::int64_t>(readSize(stream));
+    plan->memorySize = static_cast<std::int64_t>(readSize(stream));
+
+    plan->constants.resize(readCount(stream));
+    for (auto & constant : plan->constants) {
+        constant.parent = readString(stream);
+        constant.parentPort = static_cast<int>(readSize(stream));
+        constant.child = readString(stream);
+        constant.childPort = static_cast<int>(readSize(stream));
+        constant.data.resize(readCount(stream, 1));
+        stream.read(reinterpret_cast<char*>(constant.data.data()), constant.data.size());
+        if (!stream.good())
+            IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin export blob";
+        checkChecksum(stream, constant.data.data(), constant.data.size());
+    }
+
+    return plan;
+}
+
+// The snippets are replaced with the operations of their bodies, the plugin collapses them again on import
+void inlineSnippets(const std::shared_ptr<ngraph::Function> & function) {
+    for (const auto & op : function->get_ordered_ops()) {
+        auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph)
+            continue;
+        auto body = ngraph::clone_function(*subgraph->get_body());
+        const auto & parameters = body->get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++)
+            parameters[i]->output(0).replace(subgraph->input_value(i));
+        const auto & results = body->get_results();
+        for (size_t i = 0; i < results.size(); i++)
+            subgraph->output(i).replace(results[i]->input_value(0));
+    }
+}
+
+}  // namespace
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream)
+    : _ostream(ostream) {
+}
+
+void CNNNetworkSerializer::operator << (const ExportedNetwork & exported) {
+    const auto & network = exported.network;
+    auto function = ngraph::clone_function(*network.getFunction());
+    for (const auto & op : function->get_ordered_ops()) {
+        // IR keeps the precisions of the operations, not the ones overridden by the low precision transformations
+        if (std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op))
+            IE_THROW(NotImplemented) << "Export of the network with the low precision operation '" << op->get_friendly_name()
+                                     << "' is not supported";
+    }
+    inlineSnippets(function);
+
+    writeSize(_ostream, exportFormatVersion);
+
+    const auto inputsInfo = network.getInputsInfo();
+    writeSize(_ostream, inputsInfo.size());
+    for (const auto & input : inputsInfo)
+        writeDataInfo(_ostream, input.first, input.second->getInputData());
+
+    const auto outputsInfo = network.getOutputsInfo();
+    writeSize(_ostream, outputsInfo.size());
+    for (const auto & output : outputsInfo)
+        writeDataInfo(_ostream, output.first, output.second);
+
+    writeSize(_ostream, exported.dynamicInputs.size());
+    for (const auto & input : exported.dynamicInputs) {
+        writeString(_ostream, input.first);
+        writeSize(_ostream, input.second.rank().get_length());
+        for (const auto & dim : input.second) {
+            writeSize(_ostream, dim.get_min_length());
+            writeSize(_ostream, dim.get_max_length());
+        }
+    }
+    writeSize(_ostream, exported.dynamicOutputs.size());
+    for (const auto & output : exported.dynamicOutputs)
+        writeString(_ostream, output);
+
+    // Note: custom ngraph extensions are not supported
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10, getPluginOpsets());
+    serializer.run_on_function(function);
+
+    const auto model = xmlFile.str();
+    const auto weights = binFile.str();
+    writeString(_ostream, model);
+    writeChecksum(_ostream, model.data(), model.size());
+    writeString(_ostream, weights);
+    writeChecksum(_ostream, weights.data(), weights.size());
+
+    writePlan(_ostream, exported.plan ? *exported.plan : MKLDNNGraphPlan{});
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
+    : _istream(istream)
+    , _cnn_network_builder(fn) {
+}
+
+void CNNNetworkDeserializer::operator >> (ExportedNetwork & exported) {
+    if (readSize(_istream) != exportFormatVersion)
+        IE_THROW(NetworkNotRead) << "Unsupported version of the CPU plugin export blob";
+
+    struct DataInfo {
+        std::string name;
+        Precision precision;
+        Layout layout;
+    };
+    auto readDataInfo = [&]() {
+        std::vector<DataInfo> infos(readCount(_istream));
+        for (auto & info : infos) {
+            info.name = readString(_istream);
+            info.precision = Precision::FromStr(readString(_istream));
+            info.layout = static_cast<Layout>(readSize(_istream));
+        }
+        return infos;
+    };
+    const auto inputs = readDataInfo();
+    const auto outputs = readDataInfo();
+
+    exported.dynamicInputs.clear();
+    for (auto count = readSize(_istream); count > 0; count--) {
+        const auto name = readString(_istream);
+        std::vector<ngraph::Dimension> dims(readCount(_istream));
+        for (auto & dim : dims) {
+            const auto minLength = static_cast<std::int64_t>(readSize(_istream));
+            const auto maxLength = static_cast<std::int64_t>(readSize(_istream));
+            dim = ngraph::Dimension(minLength, maxLength);
+        }
+        exported.dynamicInputs[name] = ngraph::PartialShape(dims);
+    }
+    exported.dynamicOutputs.clear();
+    for (auto count = readSize(_istream); count > 0; count--)
+        exported.dynamicOutputs.insert(readString(_istream));
+
+    const auto model = readString(_istream);
+    checkChecksum(_istream, model.data(), model.size());
+    const auto weights = readString(_istream);
+    checkChecksum(_istream, weights.data(), weights.size());
+
+    Blob::Ptr weightsBlob;
+    if (!weights.empty()) {
+        weightsBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {weights.size()}, Layout::C));
+        weightsBlob->allocate();
+        std::copy(weights.begin(), weights.end(), weightsBlob->buffer().as<char*>());
+    }
+
+    auto & network = exported.network;
+    network = _cnn_network_builder(model, weightsBlob, {std::make_shared<PluginOpsetsExtension>()});
+
+    // IR doesn't keep the precisions and layouts requested by user, restore them
+    auto inputsInfo = network.getInputsInfo();
+    for (const auto & input : inputs) {
+        auto it = inputsInfo.find(input.name);
+        if (it == inputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Input " << input.name << " is not found in the imported network";
+        it->second->setPrecision(input.precision);
+        it->second->setLayout(input.layout);
+    }
+
+    auto outputsInfo = network.getOutputsInfo();
+    for (const auto & output : outputs) {
+        auto it = outputsInfo.find(output.name);
+        if (it == outputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Output " << output.name << " is not found in the imported network";
+        it->second->setPrecision(output.precision);
+        it->second->setLayout(output.layout);
+    }
+
+    exported.plan = readPlan(_istream);
+}
+
+}  // namespace MKLDNNPlugin
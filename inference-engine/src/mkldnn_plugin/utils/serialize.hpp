@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/partial_shape.hpp>
+#include "mkldnn_graph_plan.h"
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Compiled network as it is exported by the CPU plugin
+ */
+struct ExportedNetwork {
+    // The network after the plugin transformations, its inputs/outputs info keeps the precisions and layouts set by user
+    InferenceEngine::CNNNetwork network;
+    // Inputs with dynamic dimensions and outputs which shapes depend on them
+    std::map<std::string, ngraph::PartialShape> dynamicInputs;
+    std::set<std::string> dynamicOutputs;
+    MKLDNNGraphPlan::CPtr plan;
+};
+
+/**
+ * Writes a network in the format of the CPU plugin export blob: inputs/outputs info, dynamic shapes, IR xml and weights
+ * of the transformed network followed by the plan of the compiled graph.
+ * The snippets are written as the original operations, the networks with the low precision operations aren't supported.
+ */
+class CNNNetworkSerializer {
+public:
+    explicit CNNNetworkSerializer(std::ostream & ostream);
+    void operator << (const ExportedNetwork & network);
+
+private:
+    std::ostream & _ostream;
+};
+
+/**
+ * Reads a network written by CNNNetworkSerializer. IR parsing is delegated to the builder (normally ICore::ReadNetwork)
+ * which is given the extensions with the opsets of the plugin operations, the inputs/outputs info is restored on top
+ * of the parsed network.
+ */
+class CNNNetworkDeserializer {
+public:
+    typedef std::function<InferenceEngine::CNNNetwork(const std::string&, const InferenceEngine::Blob::CPtr&,
+                                                      const std::vector<InferenceEngine::IExtensionPtr>&)> cnn_network_builder;
+    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    void operator >> (ExportedNetwork & network);
+
+private:
+    std::istream & _istream;
+    cnn_network_builder _cnn_network_builder;
+};
+
+}  // namespace MKLDNNPlugin
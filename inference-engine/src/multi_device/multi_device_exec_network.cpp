@@ -9,6 +9,7 @@
 #include <memory>
 #include <utility>
 #include <map>
+#include <limits>
 #include <unordered_map>
 
 
@@ -26,6 +27,11 @@ thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecut
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName = "";
 
+namespace {
+// weight of the latest request in the exponentially weighted moving average of the device service time
+constexpr double serviceTimeEwmaFactor = 0.2;
+}  // namespace
+
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
                        MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests) :
@@ -57,9 +63,13 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _earliestCompletionScheduling = itPolicy != _config.end() &&
+        itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_EARLIEST_COMPLETION;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
+        auto* statisticsPtr = (_deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics)).get();
 
         auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
@@ -85,9 +95,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest->SetCallback(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (std::exception_ptr exceptionPtr) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                    statisticsPtr->RequestFinished(workerRequestPtr->_startTime);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -99,8 +110,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         Task t;
                         if (_inferPipelineTasks.try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            statisticsPtr->_queuedRequests--;
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
@@ -112,6 +125,10 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (_earliestCompletionScheduling && preferred_device.empty() && !devices.empty()) {
+        // the task is bound to the selected device, so it waits for this device even if another one gets idle earlier
+        preferred_device = SelectEarliestCompletionDevice(devices);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
@@ -120,19 +137,84 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
-            {
+            auto& statistics = *_deviceStatistics.at(device.deviceName);
+            workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+            statistics._inFlightRequests++;
+            try {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
+            } catch (...) {
+                statistics._inFlightRequests--;
+                throw;
             }
             idleGuard.Release();
             return;
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        _deviceStatistics.at(preferred_device)->_queuedRequests++;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectEarliestCompletionDevice(const std::vector<DeviceInformation>& devices) {
+    DeviceName selected;
+    double earliest = std::numeric_limits<double>::max();
+    // the devices are visited in the priority order, so the ties are resolved in favor of the higher priority
+    for (auto&& device : devices) {
+        const auto expected = _deviceStatistics.at(device.deviceName)->ExpectedCompletionMs(_workerRequests.at(device.deviceName).size());
+        if (expected < earliest) {
+            earliest = expected;
+            selected = device.deviceName;
+        }
+    }
+    return selected;
+}
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::RequestFinished(const std::chrono::steady_clock::time_point& startTime) {
+    const auto finishTime = std::chrono::steady_clock::now();
+    const double serviceTimeMs = std::chrono::duration<double, std::milli>(finishTime - startTime).count();
+    _inFlightRequests--;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_completedRequests == 0) {
+        _ewmaServiceTimeMs = serviceTimeMs;
+        _firstStart = startTime;
+    } else {
+        _ewmaServiceTimeMs = serviceTimeEwmaFactor * serviceTimeMs + (1.0 - serviceTimeEwmaFactor) * _ewmaServiceTimeMs;
+    }
+    _totalServiceTimeMs += serviceTimeMs;
+    _completedRequests++;
+    _lastFinish = finishTime;
+}
+
+double MultiDeviceExecutableNetwork::DeviceStatistics::ExpectedCompletionMs(size_t numWorkerRequests) const {
+    if (numWorkerRequests == 0)
+        return std::numeric_limits<double>::max();
+    const size_t busyRequests = _inFlightRequests + _queuedRequests;
+    std::lock_guard<std::mutex> lock(_mutex);
+    // until the device completes the first request the nominal 1ms service time is used,
+    // so the unmeasured idle devices are tried first and the busy ones are compared by the queue depth
+    const double serviceTimeMs = _completedRequests == 0 ? 1.0 : _ewmaServiceTimeMs;
+    if (busyRequests < numWorkerRequests)
+        return serviceTimeMs;
+    // the request starts once the worker requests drain all the requests queued ahead of it
+    return serviceTimeMs * (1.0 + static_cast<double>(busyRequests - numWorkerRequests + 1) / numWorkerRequests);
+}
+
+std::map<std::string, double> MultiDeviceExecutableNetwork::DeviceStatistics::Report() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const double elapsedMs = std::chrono::duration<double, std::milli>(_lastFinish - _firstStart).count();
+    return {
+        {"LATENCY_EWMA_MS", _ewmaServiceTimeMs},
+        {"LATENCY_AVG_MS", _completedRequests == 0 ? 0.0 : _totalServiceTimeMs / _completedRequests},
+        {"THROUGHPUT_FPS", elapsedMs > 0.0 ? _completedRequests * 1000.0 / elapsedMs : 0.0},
+        {"COMPLETED_REQUESTS", static_cast<double>(_completedRequests)},
+        {"IN_FLIGHT_REQUESTS", static_cast<double>(_inFlightRequests)},
+        {"QUEUED_REQUESTS", static_cast<double>(_queuedRequests)}
+    };
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -261,15 +343,23 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second->GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(MULTI_DEVICE_STATISTICS)) {
+        std::map<std::string, std::map<std::string, double>> statistics;
+        for (auto&& deviceStatistics : _deviceStatistics) {
+            statistics[deviceStatistics.first] = deviceStatistics.second->Report();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_STATISTICS, statistics);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
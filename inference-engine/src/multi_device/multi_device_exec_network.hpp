@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -102,6 +103,22 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
+    };
+    // service statistics of the device, drive the EARLIEST_COMPLETION scheduling and the MULTI_DEVICE_STATISTICS metric
+    struct DeviceStatistics {
+        void RequestFinished(const std::chrono::steady_clock::time_point& startTime);
+        double ExpectedCompletionMs(size_t numWorkerRequests) const;
+        std::map<std::string, double> Report() const;
+
+        mutable std::mutex                        _mutex;
+        double                                    _ewmaServiceTimeMs = 0.0;
+        double                                    _totalServiceTimeMs = 0.0;
+        size_t                                    _completedRequests = 0;
+        std::chrono::steady_clock::time_point     _firstStart;
+        std::chrono::steady_clock::time_point     _lastFinish;
+        std::atomic_size_t                        _inFlightRequests = {0};
+        std::atomic_size_t                        _queuedRequests = {0};
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -121,6 +138,7 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    DeviceName SelectEarliestCompletionDevice(const std::vector<DeviceInformation>& devices);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -135,8 +153,10 @@ public:
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    bool                                                        _earliestCompletionScheduling = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
 };
 
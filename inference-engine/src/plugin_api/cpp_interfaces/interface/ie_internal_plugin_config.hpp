@@ -38,6 +38,13 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Number of attempts to get a task an idle CPU Executor Stream thread makes before going to sleep,
+ *        trades the CPU time of the idle streams for the latency of the tasks submitted to them
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPIN_WAIT_ITERATIONS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -45,6 +52,28 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Enables inter-op parallelism in the CPU plugin: independent graph branches are executed concurrently
+ *        on the stream threads (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
+/**
+ * @brief Maximum number of JIT kernels kept in the process-wide kernel cache of the CPU plugin (1024 by default).
+ *        The cache is shared by all the networks, so the value is applied only via Core::SetConfig. Zero disables caching
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_KERNEL_CACHE_CAPACITY);
+
+/**
+ * @brief Marks the operations executed by the CPU plugin through the ngraph reference implementation in the
+ *        performance counters: such layers report their original operation type and the "ref_fallback"
+ *        execution type (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_REPORT_REFERENCE_FALLBACKS);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -51,6 +51,36 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get median execution time of the executable primitive across the latest inferences.
+ */
+static const char PERF_COUNTER_P50[] = "execTimeP50Mcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get 90th percentile of the execution time of the executable primitive across the latest inferences.
+ */
+static const char PERF_COUNTER_P90[] = "execTimeP90Mcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get 99th percentile of the execution time of the executable primitive across the latest inferences.
+ */
+static const char PERF_COUNTER_P99[] = "execTimeP99Mcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get amount of memory in bytes read and written by a single execution of the primitive.
+ */
+static const char MEMORY_TRAFFIC[] = "bytesMoved";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get estimated number of floating point operations of a single execution of the primitive.
+ */
+static const char FLOPS[] = "flops";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
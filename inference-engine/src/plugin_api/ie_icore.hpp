@@ -12,6 +12,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <ie_parameter.hpp>
 #include <cpp/ie_cnn_network.h>
@@ -42,6 +43,17 @@ public:
      */
     virtual CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const = 0;
 
+    /**
+     * @brief Reads IR xml and bin (with the same name) files which use operations of the given extensions
+     * @param model string with IR
+     * @param weights shared pointer to constant blob with weights
+     * @param extensions extensions with opsets of the IR in addition to the extensions added to Core,
+     * e.g. a plugin reads back the network with the plugin specific operations
+     * @return CNNNetwork
+     */
+    virtual CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights,
+                                   const std::vector<IExtensionPtr>& extensions) const = 0;
+
     /**
      * @brief Reads IR xml and bin files
      * @param modelPath path to IR file
@@ -93,6 +93,7 @@ public:
             BIG,
             ROUND_ROBIN // used w/multiple streams to populate the Big cores first, then the Little, then wrap around (for large #streams)
         }                  _threadPreferredCoreType = PreferredCoreType::ANY; //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int                _spinWaitIterations      = 0;  //!< Number of attempts to get a task an idle stream thread makes before going to sleep
 
         /**
          * @brief      A constructor with arguments
@@ -105,6 +106,7 @@ public:
          * @param[in]  threadBindingOffset  @copybrief Config::_threadBindingOffset
          * @param[in]  threads              @copybrief Config::_threads
          * @param[in]  threadPreferBigCores @copybrief Config::_threadPreferBigCores
+         * @param[in]  spinWaitIterations   @copybrief Config::_spinWaitIterations
          */
         Config(
             std::string        name                    = "StreamsExecutor",
@@ -114,14 +116,16 @@ public:
             int                threadBindingStep       = 1,
             int                threadBindingOffset     = 0,
             int                threads                 = 0,
-            PreferredCoreType  threadPreferredCoreType = PreferredCoreType::ANY) :
+            PreferredCoreType  threadPreferredCoreType = PreferredCoreType::ANY,
+            int                spinWaitIterations      = 0) :
         _name{name},
         _streams{streams},
         _threadsPerStream{threadsPerStream},
         _threadBindingType{threadBindingType},
         _threadBindingStep{threadBindingStep},
         _threadBindingOffset{threadBindingOffset},
-        _threads{threads}, _threadPreferredCoreType(threadPreferredCoreType){
+        _threads{threads}, _threadPreferredCoreType(threadPreferredCoreType),
+        _spinWaitIterations{spinWaitIterations} {
         }
     };
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <transformations_visibility.hpp>
+#include <ngraph/node.hpp>
 
 #include <vector>
 #include <cstdint>
@@ -31,6 +32,8 @@ public:
     Emitter(std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>>& region) {
     }
 
+    virtual ~Emitter() = default;
+
     /**
      * @brief called by generator to generate code to produce target code for a specific operation
      * @param in vector of vector argument registers
@@ -15,6 +15,19 @@ namespace ngraph {
 namespace snippets {
 namespace pass {
 
+/**
+ * @brief Marks an operation which the plugin is going to fuse into another one, so it is neither
+ * used to start a new subgraph nor attached to an existing one
+ * @ingroup snippets
+ */
+TRANSFORMATIONS_API void SetSkippedByPlugin(const std::shared_ptr<Node>& node);
+
+/**
+ * @brief Checks if an operation was marked with SetSkippedByPlugin
+ * @ingroup snippets
+ */
+TRANSFORMATIONS_API bool IsSkippedByPlugin(const std::shared_ptr<const Node>& node);
+
 /**
  * @interface StartSubgraph
  * @brief Matches multiple output loyout-oblivious operations to start a new subgraph
@@ -169,15 +169,17 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     // TODO: store blocking into to Parameter's rt_info for future propagation
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
         auto param = m_body->get_parameters()[i];
-        if (param->get_shape().size() < 4) {
+        const auto& passed_shape = std::get<0>(input_shapes[i]);
+        // plugin may pass 4D+ shapes for lower rank parameters as well, e.g. with collapsed dimensions
+        if (param->get_shape().size() < 4 && passed_shape.size() < 4) {
             std::vector<size_t> shape(4, 1);
             std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
             m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
-        } else if (param->get_shape().size() >= 4) {
+        } else {
             if (param->get_element_type() != std::get<2>(input_shapes[i])) {
                 throw ngraph::ngraph_error("changes in presision. Is it legal??");
             }
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), std::get<0>(input_shapes[i])));
+            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), passed_shape));
         }
     }
 
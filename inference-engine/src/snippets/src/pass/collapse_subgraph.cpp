@@ -28,6 +28,8 @@ using namespace snippets;
 
 namespace {
 
+const char skipped_by_plugin_key[] = "SnippetsSkippedByPlugin";
+
 auto outputs_are_not_broadcastable(const std::shared_ptr<ngraph::Node>& node) -> bool {
     auto outputs = node->outputs();
     auto find_smallest_output_shape = [](const std::vector<ngraph::Output<ngraph::Node>>& outputs) -> ngraph::Shape {
@@ -223,6 +225,14 @@ auto has_supported_in_out(std::shared_ptr<Node> n) -> bool {
 
 } // namespace
 
+void ngraph::snippets::pass::SetSkippedByPlugin(const std::shared_ptr<Node>& node) {
+    node->get_rt_info()[skipped_by_plugin_key] = std::make_shared<VariantWrapper<int64_t>>(1);
+}
+
+bool ngraph::snippets::pass::IsSkippedByPlugin(const std::shared_ptr<const Node>& node) {
+    return node->get_rt_info().count(skipped_by_plugin_key) != 0;
+}
+
 ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : MatcherPass() {
     MATCHER_SCOPE(StartSubgraph);
 
@@ -238,6 +248,7 @@ ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : Ma
         std::make_shared<pattern::op::Label>(pattern::any_input(),
         [tokenize_by_node, has_multiple_output_edges](std::shared_ptr<Node> n) {
             return is_lo(n) &&
+                   !IsSkippedByPlugin(n) &&
                    has_supported_in_out(n) &&
                    (tokenize_by_node || !has_subgraph_as_input(n)) &&
                    has_multiple_output_edges(n);
@@ -524,7 +535,7 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
     register_matcher(std::make_shared<pattern::Matcher>(
         std::make_shared<pattern::op::Label>(pattern::any_input(),
         [](std::shared_ptr<Node> n) {
-            return is_lo(n) && has_supported_in_out(n) && has_subgraph_as_input(n);
+            return is_lo(n) && !IsSkippedByPlugin(n) && has_supported_in_out(n) && has_subgraph_as_input(n);
         })),
         continuation_callback);
 }
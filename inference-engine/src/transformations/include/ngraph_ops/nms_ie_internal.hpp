@@ -21,6 +21,8 @@ public:
     static constexpr NodeTypeInfo type_info{"NonMaxSuppressionIEInternal", 0};
     const NodeTypeInfo& get_type_info() const override { return type_info; }
 
+    NonMaxSuppressionIEInternal() = default;
+
     NonMaxSuppressionIEInternal(const Output<Node>& boxes,
                                 const Output<Node>& scores,
                                 const Output<Node>& max_output_boxes_per_class,
@@ -46,7 +48,7 @@ public:
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector & new_args) const override;
 
-    int m_center_point_box;
+    int m_center_point_box = 0;
     bool m_sort_result_descending = true;
     element::Type m_output_type;
 
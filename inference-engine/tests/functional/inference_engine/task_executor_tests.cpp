@@ -2,13 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -211,3 +218,77 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+class CPUStreamsExecutorLatencyTests : public ::testing::TestWithParam<int> {
+protected:
+    struct ProducersRun {
+        int producers = 0;
+        std::vector<std::chrono::nanoseconds> latencies;  // from the submission of a task to its start
+        int runOnProducerThread = 0;
+    };
+
+    // Concurrent producers submit the tasks one by one, every producer waits for its task before submitting the next one
+    static ProducersRun runProducers(int spinWaitIterations, int tasksPerProducer) {
+        const int streams = std::max(1, getNumberOfCPUCores() / 2);
+        const int producers = std::max(1, streams / 2);
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config.SetConfig(CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS), std::to_string(spinWaitIterations));
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+
+        std::vector<std::vector<std::chrono::nanoseconds>> latencies(producers);
+        std::vector<int> runOnProducerThread(producers, 0);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&, p] {
+                const auto producerId = std::this_thread::get_id();
+                for (int i = 0; i < tasksPerProducer; i++) {
+                    const auto start = std::chrono::steady_clock::now();
+                    std::chrono::nanoseconds latency;
+                    bool onProducer = false;
+                    async(taskExecutor, [&] {
+                        latency = std::chrono::steady_clock::now() - start;
+                        onProducer = std::this_thread::get_id() == producerId;
+                    }).wait();
+                    latencies[p].push_back(latency);
+                    runOnProducerThread[p] += onProducer;
+                }
+            });
+        }
+        for (auto&& thread : threads) thread.join();
+
+        ProducersRun run;
+        run.producers = producers;
+        for (int p = 0; p < producers; p++) {
+            run.latencies.insert(run.latencies.end(), latencies[p].begin(), latencies[p].end());
+            run.runOnProducerThread += runOnProducerThread[p];
+        }
+        return run;
+    }
+};
+
+// Every task submitted by concurrent producers is executed by a stream thread, either when the streams sleep
+// on the wait or when they spin before it, so no wakeup is lost (a lost one hangs the test)
+TEST_P(CPUStreamsExecutorLatencyTests, enqueuedTasksRunOnStreamsWithoutLostWakeups) {
+    constexpr int NUM_TASKS_PER_PRODUCER = 2000;
+    const auto run = runProducers(GetParam(), NUM_TASKS_PER_PRODUCER);
+
+    ASSERT_EQ(run.producers * NUM_TASKS_PER_PRODUCER, run.latencies.size());
+    ASSERT_EQ(0, run.runOnProducerThread);
+}
+
+// Reports the percentiles of the task start latency, run with --gtest_also_run_disabled_tests
+TEST_P(CPUStreamsExecutorLatencyTests, DISABLED_benchmarkTaskStartLatency) {
+    constexpr int NUM_TASKS_PER_PRODUCER = 20000;
+    auto latencies = runProducers(GetParam(), NUM_TASKS_PER_PRODUCER).latencies;
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&] (size_t p) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(latencies[(latencies.size() - 1) * p / 100]).count();
+    };
+    RecordProperty("p50_us", std::to_string(percentile(50)));
+    RecordProperty("p99_us", std::to_string(percentile(99)));
+    std::cout << "spin wait iterations: " << GetParam() << ", tasks: " << latencies.size()
+              << ", start latency p50: " << percentile(50) << " us, p99: " << percentile(99) << " us" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorLatencyTests, CPUStreamsExecutorLatencyTests, ::testing::Values(0, 1000));
@@ -0,0 +1,17 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_scheduling_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+// two instances of the CPU plugin stand for the devices of different performance
+const std::vector<std::vector<MultiSchedulingDevice>> devices_for_scheduling {
+        {{"CPU0", "MKLDNNPlugin", {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}},
+         {"CPU1", "MKLDNNPlugin", {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"}, {CONFIG_KEY(CPU_THREADS_NUM), "1"}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SchedulingMultiCPU, MultiDevice_SchedulingTest,
+        ::testing::ValuesIn(devices_for_scheduling), MultiDevice_SchedulingTest::getTestCaseName);
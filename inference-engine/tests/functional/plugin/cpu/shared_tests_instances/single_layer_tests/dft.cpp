@@ -100,8 +100,29 @@ const auto testCase4D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* 1D DFT of audio frames: mixed radix (400, 480) and prime (127) lengths */
+
+const std::vector<std::vector<size_t>> frameShapes = {
+    {3, 400, 2},
+    {2, 480, 2},
+    {4, 127, 2},
+};
+
+const std::vector<std::vector<int64_t>> signalSizesFrames = {
+    {}, {512}, {257}
+};
+
+const auto testCaseFrames = ::testing::Combine(
+    ::testing::ValuesIn(frameShapes),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::Values(std::vector<int64_t>{1}),
+    ::testing::ValuesIn(signalSizesFrames),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
 
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_frames, DFTLayerTest, testCaseFrames, DFTLayerTest::getTestCaseName);
@@ -13,6 +13,7 @@ namespace {
 
 const std::vector<InferenceEngine::Precision> netPrecisions = {
         InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::BF16,
         InferenceEngine::Precision::I32,
         InferenceEngine::Precision::U8
 };
@@ -51,4 +51,33 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+// large k values and long axes are ranked by the partial sort, which splits the axis when there are few rows
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LargeK, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::Values(32, 100),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({2, 20000}), std::vector<size_t>({3, 200, 5})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_Integer, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::Values(1, 5, 40),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::I32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({4, 50, 3})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset8.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using AdaptivePoolingCPUTestParamsSet = std::tuple<
+        std::string,            // mode: "avg" or "max"
+        std::vector<size_t>,    // input shape
+        std::vector<int64_t>,   // pooled spatial shape
+        CPUSpecificParams>;
+
+class AdaptivePoolingLayerCPUTest : public testing::WithParamInterface<AdaptivePoolingCPUTestParamsSet>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<AdaptivePoolingCPUTestParamsSet> obj) {
+        std::string mode;
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> pooledShape;
+        CPUSpecificParams cpuParams;
+        std::tie(mode, inputShape, pooledShape, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << "mode=" << mode << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "PS=" << CommonTestUtils::vec2str(pooledShape);
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::string mode;
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> pooledShape;
+        CPUSpecificParams cpuParams;
+        std::tie(mode, inputShape, pooledShape, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto pooled = ngraph::opset8::Constant::create(ngraph::element::i64, {pooledShape.size()}, pooledShape);
+        std::shared_ptr<ngraph::Node> pooling;
+        if (mode == "max") {
+            pooling = std::make_shared<ngraph::opset8::AdaptiveMaxPool>(params[0], pooled, ngraph::element::i32);
+        } else {
+            pooling = std::make_shared<ngraph::opset8::AdaptiveAvgPool>(params[0], pooled);
+        }
+        pooling->get_rt_info() = getCPUInfo();
+
+        ngraph::ResultVector results;
+        for (const auto& output : pooling->outputs())
+            results.push_back(std::make_shared<ngraph::opset8::Result>(output));
+        function = std::make_shared<ngraph::Function>(results, params, "AdaptivePooling");
+    }
+};
+
+TEST_P(AdaptivePoolingLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "AdaptivePooling");
+}
+
+namespace {
+
+const std::vector<std::string> modes = {"avg", "max"};
+
+const CPUSpecificParams planar3D{{abc}, {abc}, {}, "ref_any_FP32"};
+const CPUSpecificParams planar4D{{nchw}, {nchw}, {}, "ref_any_FP32"};
+const CPUSpecificParams planar5D{{ncdhw}, {ncdhw}, {}, "ref_any_FP32"};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaptivePooling3D, AdaptivePoolingLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(modes),
+            ::testing::Values(std::vector<size_t>{2, 3, 17}),
+            ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{1}, {5}, {17}}),
+            ::testing::Values(planar3D)),
+        AdaptivePoolingLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaptivePooling4D, AdaptivePoolingLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(modes),
+            ::testing::Values(std::vector<size_t>{1, 8, 13, 20}),
+            ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{1, 1}, {3, 7}, {13, 20}, {16, 24}}),
+            ::testing::Values(planar4D)),
+        AdaptivePoolingLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaptivePooling5D, AdaptivePoolingLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(modes),
+            ::testing::Values(std::vector<size_t>{2, 4, 7, 9, 11}),
+            ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{2, 3, 4}, {7, 1, 5}}),
+            ::testing::Values(planar5D)),
+        AdaptivePoolingLayerCPUTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPULayerTestsDefinitions
@@ -198,6 +198,22 @@ const auto testParams = ::testing::Combine(gemmParams,
 
 INSTANTIATE_TEST_SUITE_P(smoke_Check, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
+std::vector<fusingSpecificParams> fusingParamsSet {
+        fusingRelu,
+        fusingGelu,
+        fusingMultiplyPerTensor,
+        fusingMultiplyPerChannel,
+        fusingAddPerChannel,
+        fusingPReluPerTensor,
+        fusingReluScaleShift
+};
+
+const auto testParamsFusing = ::testing::Combine(gemmParams,
+                                                 ::testing::Values(MatMulNodeType::MatMul),
+                                                 ::testing::ValuesIn(fusingParamsSet));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_Fusing, MatMulLayerCPUTest, testParamsFusing, MatMulLayerCPUTest::getTestCaseName);
+
 }; // namespace gemm
 
 } // namespace
@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/non_max_suppression.hpp>
+
+using namespace LayerTestsDefinitions;
+using namespace InferenceEngine;
+using namespace ngraph;
+
+namespace CPULayerTestsDefinitions  {
+
+// The candidates are selected in chunks and compared with the selected boxes in blocks,
+// so the sets of many boxes check that the order of the selection is kept
+class NmsCPULayerTest : public NmsLayerTest {};
+
+TEST_P(NmsCPULayerTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+// The scores take only a few distinct values, so most of the candidates tie
+// and the boxes with equal scores must be selected in the order of their indices
+class NmsTiedScoresCPULayerTest : public NmsLayerTest {
+public:
+    void GenerateInputs() override {
+        NmsLayerTest::GenerateInputs();
+
+        auto memory = as<MemoryBlob>(inputs[1]);
+        IE_ASSERT(memory);
+        const auto lockedMemory = memory->wmap();
+        auto scores = lockedMemory.as<float *>();
+        for (size_t i = 0; i < inputs[1]->size(); i++)
+            scores[i] = 0.1f * static_cast<float>((i * 7919) % 10);
+    }
+};
+
+TEST_P(NmsTiedScoresCPULayerTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<InputShapeParams> largeShapeParams = {
+    InputShapeParams{1, 2500, 2},
+    InputShapeParams{2, 1000, 3}
+};
+
+const std::vector<int32_t> maxOutBoxPerClass = {10, 200, 2500};
+const std::vector<float> iouThreshold = {0.3f, 0.7f};
+const std::vector<float> scoreThreshold = {0.0f, 0.4f};
+const std::vector<float> sigmaThreshold = {0.0f, 0.5f};
+const std::vector<bool> sortResDesc = {true, false};
+
+const auto largeNmsParams = ::testing::Combine(::testing::ValuesIn(largeShapeParams),
+                                               ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                  ::testing::Values(Precision::I32),
+                                                                  ::testing::Values(Precision::FP32)),
+                                               ::testing::ValuesIn(maxOutBoxPerClass),
+                                               ::testing::ValuesIn(iouThreshold),
+                                               ::testing::ValuesIn(scoreThreshold),
+                                               ::testing::ValuesIn(sigmaThreshold),
+                                               ::testing::Values(op::v5::NonMaxSuppression::BoxEncodingType::CORNER),
+                                               ::testing::ValuesIn(sortResDesc),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLargeBoxesCount, NmsCPULayerTest, largeNmsParams, NmsLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsTiedScores, NmsTiedScoresCPULayerTest, largeNmsParams, NmsLayerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
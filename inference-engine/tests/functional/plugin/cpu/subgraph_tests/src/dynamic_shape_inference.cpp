@@ -0,0 +1,165 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+// Param [1, 1..32] -> Relu -> Result
+std::shared_ptr<Function> makeBoundedRelu(const PartialShape& shape) {
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto relu = std::make_shared<opset5::Relu>(param);
+    relu->set_friendly_name("relu");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(relu)}, ParameterVector{param}, "BoundedRelu");
+}
+
+// Param [1, 3, H, W] -> Convolution 3x3 -> MaxPool 2x2 -> Result
+std::shared_ptr<Function> makeConvPool(const PartialShape& shape) {
+    std::vector<float> weights(8 * 3 * 3 * 3);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / 8.f;
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto conv = std::make_shared<opset5::Convolution>(param, opset5::Constant::create(element::f32, {8, 3, 3, 3}, weights),
+                                                      Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}, Strides{1, 1});
+    auto pool = std::make_shared<opset5::MaxPool>(conv, Strides{2, 2}, Shape{0, 0}, Shape{0, 0}, Shape{2, 2}, op::RoundingType::CEIL);
+    pool->set_friendly_name("pool");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(pool)}, ParameterVector{param}, "ConvPool");
+}
+
+// Param [1, C] -> Relu -> Add with Param -> Swish as x * Sigmoid(x) -> Result
+// The elementwise chain is collapsed into a snippet for the static shapes
+std::shared_ptr<Function> makeResidualSwish(const PartialShape& shape) {
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto relu = std::make_shared<opset5::Relu>(param);
+    auto add = std::make_shared<opset5::Add>(param, relu);
+    auto sigmoid = std::make_shared<opset5::Sigmoid>(add);
+    auto swish = std::make_shared<opset5::Multiply>(add, sigmoid);
+    swish->set_friendly_name("swish");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(swish)}, ParameterVector{param}, "ResidualSwish");
+}
+
+// Self attention over the sequence of Param [1, L, 16]:
+// MVN -> MatMul with its transposition -> Softmax -> MatMul with MVN -> Gather of 4 features -> Transpose to [1, 4, L]
+std::shared_ptr<Function> makeAttention(const PartialShape& shape) {
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto mvn = std::make_shared<opset6::MVN>(param, opset5::Constant::create(element::i64, {1}, {2}), true, 1e-9f,
+                                             op::MVNEpsMode::INSIDE_SQRT);
+    auto keys = std::make_shared<opset5::Transpose>(mvn, opset5::Constant::create(element::i64, {3}, {0, 2, 1}));
+    auto scores = std::make_shared<opset5::MatMul>(mvn, keys);
+    auto softmax = std::make_shared<opset5::Softmax>(scores, 2);
+    auto context = std::make_shared<opset5::MatMul>(softmax, mvn);
+    auto gather = std::make_shared<opset5::Gather>(context, opset5::Constant::create(element::i32, {4}, {0, 3, 5, 15}),
+                                                   opset5::Constant::create(element::i64, {}, {2}));
+    auto transpose = std::make_shared<opset5::Transpose>(gather, opset5::Constant::create(element::i64, {3}, {0, 2, 1}));
+    transpose->set_friendly_name("transpose");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(transpose)}, ParameterVector{param}, "Attention");
+}
+
+// Infers the shapes one after another with the network compiled for the dynamic shape and compares the output
+// with the networks compiled for each of the shapes
+void compareWithStaticNetworks(const std::function<std::shared_ptr<Function>(const PartialShape&)>& makeFunction,
+                               const PartialShape& dynamicShape, const std::vector<SizeVector>& shapes, Layout layout,
+                               const std::string& outputName) {
+    Core ie;
+    CNNNetwork network(makeFunction(dynamicShape));
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    for (const auto& dims : shapes) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, dims, layout}, 10, -5, 1, static_cast<int32_t>(dims.back()));
+        request.SetBlob("param", input);
+        request.Infer();
+        auto output = request.GetBlob(outputName);
+
+        CNNNetwork staticNetwork(makeFunction(PartialShape(dims)));
+        auto staticRequest = ie.LoadNetwork(staticNetwork, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        staticRequest.SetBlob("param", input);
+        staticRequest.Infer();
+        auto expected = staticRequest.GetBlob(outputName);
+
+        ASSERT_EQ(output->getTensorDesc().getDims(), expected->getTensorDesc().getDims());
+        auto outputData = output->cbuffer().as<const float*>();
+        auto expectedData = expected->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected->size(); i++) {
+            ASSERT_NEAR(outputData[i], expectedData[i], 1e-4f) << "shape: " << PartialShape(dims) << ", index: " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(DynamicShapeInferenceTest, canInferDifferentShapesWithinBounds) {
+    Core ie;
+    CNNNetwork network(makeBoundedRelu({1, Dimension(1, 32)}));
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNetwork.CreateInferRequest();
+
+    // The graph is compiled once for the upper bound and reshaped for each shape, the shapes go both down and up
+    for (size_t length : {32lu, 7lu, 1lu, 19lu, 7lu}) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, {1, length}, Layout::NC}, 10, -5, 1, static_cast<int32_t>(length));
+        request.SetBlob("param", input);
+        request.Infer();
+
+        auto output = request.GetBlob("relu");
+        ASSERT_EQ(output->getTensorDesc().getDims(), (SizeVector{1, length}));
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < length; i++) {
+            ASSERT_EQ(outputData[i], std::max(inputData[i], 0.f)) << "length: " << length << ", index: " << i;
+        }
+    }
+}
+
+TEST(DynamicShapeInferenceTest, reshapedConvolutionAndPoolingMatchStaticNetwork) {
+    // The shapes are repeated to take the primitives created for them before
+    compareWithStaticNetworks(makeConvPool, {1, 3, Dimension(8, 32), Dimension(8, 32)},
+                              {{1, 3, 32, 32}, {1, 3, 9, 15}, {1, 3, 8, 8}, {1, 3, 27, 32}, {1, 3, 9, 15}, {1, 3, 32, 32}},
+                              Layout::NCHW, "pool");
+}
+
+TEST(DynamicShapeInferenceTest, reshapedElementwiseChainMatchesStaticNetworkWithSnippets) {
+    compareWithStaticNetworks(makeResidualSwish, {1, Dimension(1, 64)},
+                              {{1, 64}, {1, 17}, {1, 1}, {1, 17}, {1, 64}}, Layout::NC, "swish");
+}
+
+TEST(DynamicShapeInferenceTest, reshapedAttentionMatchesStaticNetwork) {
+    compareWithStaticNetworks(makeAttention, {1, Dimension(1, 24), 16},
+                              {{1, 24, 16}, {1, 5, 16}, {1, 1, 16}, {1, 13, 16}, {1, 5, 16}, {1, 24, 16}}, Layout::CHW, "transpose");
+}
+
+TEST(DynamicShapeInferenceTest, throwsOnInputShapeOutOfBounds) {
+    Core ie;
+    CNNNetwork network(makeBoundedRelu({1, Dimension(1, 32)}));
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 33}, Layout::NC});
+    input->allocate();
+    ASSERT_THROW(request.SetBlob("param", input), Exception);
+}
+
+TEST(DynamicShapeInferenceTest, throwsOnUnboundedDimension) {
+    Core ie;
+    CNNNetwork network(makeBoundedRelu({1, Dimension::dynamic()}));
+    ASSERT_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU), NotImplemented);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,149 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include <cmath>
+#include <numeric>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// ParamA   ParamB
+//     \     /
+//       Add
+//      /   \
+//  Sigmoid  |
+//      \   /
+//    Multiply
+//       |
+//    Subtract(constant)
+//
+// Add, Sigmoid and Multiply are expected to be collapsed into a single JIT compiled Subgraph node
+using EltwiseSnippetsParams = std::tuple<SizeVector,   // shape A
+                                         SizeVector>;  // shape B
+
+class EltwiseSnippetsTest : public testing::TestWithParam<EltwiseSnippetsParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EltwiseSnippetsParams> obj) {
+        SizeVector shapeA, shapeB;
+        std::tie(shapeA, shapeB) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_A=" << CommonTestUtils::vec2str(shapeA) << "_IS_B=" << CommonTestUtils::vec2str(shapeB);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::tie(shapeA, shapeB) = GetParam();
+
+        auto paramA = std::make_shared<opset1::Parameter>(element::f32, Shape(shapeA));
+        paramA->set_friendly_name("paramA");
+        auto paramB = std::make_shared<opset1::Parameter>(element::f32, Shape(shapeB));
+        paramB->set_friendly_name("paramB");
+        auto add = std::make_shared<opset1::Add>(paramA, paramB);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(add);
+        auto multiply = std::make_shared<opset1::Multiply>(add, sigmoid);
+        auto subtract = std::make_shared<opset1::Subtract>(multiply, opset1::Constant::create(element::f32, Shape{}, {shift}));
+        subtract->set_friendly_name("subtract");
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(subtract)}, ParameterVector{paramA, paramB},
+                                              "EltwiseSnippets");
+    }
+
+    SizeVector shapeA, shapeB;
+    const float shift = 0.5f;
+    std::shared_ptr<Function> function;
+};
+
+TEST_P(EltwiseSnippetsTest, CompareWithRefs) {
+    if (!with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    Core ie;
+    auto execNetwork = ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU);
+
+    size_t subgraphCount = 0;
+    for (const auto &node : execNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto &rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        ASSERT_NE(rtInfo.end(), it);
+        auto layerType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)->get();
+        if (layerType == "Subgraph")
+            subgraphCount++;
+    }
+    ASSERT_EQ(1, subgraphCount);
+
+    auto request = execNetwork.CreateInferRequest();
+    auto inputA = FuncTestUtils::createAndFillBlob({Precision::FP32, shapeA, TensorDesc::getLayoutByDims(shapeA)}, 10, -5, 10);
+    auto inputB = FuncTestUtils::createAndFillBlob({Precision::FP32, shapeB, TensorDesc::getLayoutByDims(shapeB)}, 6, -3, 10);
+    request.SetBlob("paramA", inputA);
+    request.SetBlob("paramB", inputB);
+    request.Infer();
+
+    // numpy broadcast of the inputs aligned by the innermost dimension
+    const size_t rank = std::max(shapeA.size(), shapeB.size());
+    SizeVector dimsA(rank - shapeA.size(), 1), dimsB(rank - shapeB.size(), 1);
+    dimsA.insert(dimsA.end(), shapeA.begin(), shapeA.end());
+    dimsB.insert(dimsB.end(), shapeB.begin(), shapeB.end());
+    SizeVector dimsOut(rank);
+    for (size_t d = 0; d < rank; d++)
+        dimsOut[d] = std::max(dimsA[d], dimsB[d]);
+
+    auto dataA = inputA->cbuffer().as<const float*>();
+    auto dataB = inputB->cbuffer().as<const float*>();
+    auto outputData = request.GetBlob("subtract")->cbuffer().as<const float*>();
+    const size_t outSize = std::accumulate(dimsOut.begin(), dimsOut.end(), size_t(1), std::multiplies<size_t>());
+    for (size_t i = 0; i < outSize; i++) {
+        size_t rest = i, offA = 0, offB = 0, strideA = 1, strideB = 1;
+        for (int d = static_cast<int>(rank) - 1; d >= 0; d--) {
+            const size_t idx = rest % dimsOut[d];
+            rest /= dimsOut[d];
+            offA += (dimsA[d] == 1 ? 0 : idx) * strideA;
+            offB += (dimsB[d] == 1 ? 0 : idx) * strideB;
+            strideA *= dimsA[d];
+            strideB *= dimsB[d];
+        }
+        const float sum = dataA[offA] + dataB[offB];
+        const float expected = sum / (1.f + std::exp(-sum)) - shift;
+        ASSERT_NEAR(expected, outputData[i], 1e-4f * std::max(1.f, std::fabs(expected))) << "at " << i;
+    }
+}
+
+namespace {
+
+const std::vector<std::pair<SizeVector, SizeVector>> inputShapes = {
+    {{1, 3, 16, 16}, {1, 3, 16, 16}},
+    {{1, 3, 16, 16}, {1, 3, 1, 16}},
+    {{1, 3, 16, 16}, {1, 3, 16, 1}},
+    {{1, 42, 17, 15}, {1, 1, 17, 15}},
+    {{2, 5, 7}, {7}},
+    {{3, 1, 10}, {1, 4, 1}},
+    {{1, 2, 3, 4, 37}, {1, 2, 1, 4, 37}},
+};
+
+std::vector<EltwiseSnippetsParams> makeParams() {
+    std::vector<EltwiseSnippetsParams> params;
+    for (const auto& shapes : inputShapes)
+        params.emplace_back(shapes.first, shapes.second);
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, EltwiseSnippetsTest,
+                         ::testing::ValuesIn(makeParams()),
+                         EltwiseSnippetsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,199 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset5.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+// Param [1, 3, H, W] -> Convolution 3x3 -> Relu -> MaxPool 2x2 -> Result
+std::shared_ptr<Function> makeConvReluPool(const PartialShape& shape) {
+    std::vector<float> weights(8 * 3 * 3 * 3);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / 8.f;
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto conv = std::make_shared<opset5::Convolution>(param, opset5::Constant::create(element::f32, {8, 3, 3, 3}, weights),
+                                                      Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}, Strides{1, 1});
+    auto relu = std::make_shared<opset5::Relu>(conv);
+    auto pool = std::make_shared<opset5::MaxPool>(relu, Strides{2, 2}, Shape{0, 0}, Shape{0, 0}, Shape{2, 2}, op::RoundingType::CEIL);
+    pool->set_friendly_name("output");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(pool)}, ParameterVector{param}, "ConvReluPool");
+}
+
+// Param [1, C] -> Add with Relu of Param -> x * Sigmoid(x) -> Result
+// The elementwise chain is collapsed into a snippet on AVX2 machines
+std::shared_ptr<Function> makeResidualSwish(const PartialShape& shape) {
+    auto param = std::make_shared<opset5::Parameter>(element::f32, shape);
+    param->set_friendly_name("param");
+    auto add = std::make_shared<opset5::Add>(param, std::make_shared<opset5::Relu>(param));
+    auto swish = std::make_shared<opset5::Multiply>(add, std::make_shared<opset5::Sigmoid>(add));
+    swish->set_friendly_name("output");
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset5::Result>(swish)}, ParameterVector{param}, "ResidualSwish");
+}
+
+std::string exportToString(ExecutableNetwork& execNetwork) {
+    std::stringstream blob;
+    execNetwork.Export(blob);
+    return blob.str();
+}
+
+ExecutableNetwork importFromString(Core& ie, const std::string& blob) {
+    std::stringstream stream(blob);
+    return ie.ImportNetwork(stream, CommonTestUtils::DEVICE_CPU);
+}
+
+size_t countLayersOfType(ExecutableNetwork& execNetwork, const std::string& type) {
+    size_t count = 0;
+    for (const auto& node : execNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        if (it != rtInfo.end() && std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second)->get() == type)
+            count++;
+    }
+    return count;
+}
+
+// Infers the shapes with both networks and compares the outputs
+void compareInference(ExecutableNetwork& expectedNetwork, ExecutableNetwork& actualNetwork, const std::vector<SizeVector>& shapes) {
+    auto expectedRequest = expectedNetwork.CreateInferRequest();
+    auto actualRequest = actualNetwork.CreateInferRequest();
+    for (const auto& dims : shapes) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)}, 10, -5, 1,
+                                                      static_cast<int32_t>(dims.back()));
+        expectedRequest.SetBlob("param", input);
+        expectedRequest.Infer();
+        actualRequest.SetBlob("param", input);
+        actualRequest.Infer();
+
+        auto expected = expectedRequest.GetBlob("output");
+        auto actual = actualRequest.GetBlob("output");
+        ASSERT_EQ(expected->getTensorDesc().getDims(), actual->getTensorDesc().getDims());
+        auto expectedData = expected->cbuffer().as<const float*>();
+        auto actualData = actual->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected->size(); i++) {
+            // the same primitives are executed for the same data
+            ASSERT_EQ(expectedData[i], actualData[i]) << "shape: " << PartialShape(dims) << ", index: " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ExportImportTest, importedNetworkMatchesLoadedNetwork) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeConvReluPool({1, 3, 17, 23})), CommonTestUtils::DEVICE_CPU);
+    auto imported = importFromString(ie, exportToString(loaded));
+
+    ASSERT_EQ(loaded.GetInputsInfo().size(), imported.GetInputsInfo().size());
+    ASSERT_EQ(1, imported.GetInputsInfo().count("param"));
+    ASSERT_EQ(1, imported.GetOutputsInfo().count("output"));
+    compareInference(loaded, imported, {{1, 3, 17, 23}});
+}
+
+TEST(ExportImportTest, importedNetworkWithSnippetsMatchesLoadedNetwork) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeResidualSwish({1, 67})), CommonTestUtils::DEVICE_CPU);
+    auto imported = importFromString(ie, exportToString(loaded));
+
+    // the snippets are exported as their operations and collapsed again on import
+    ASSERT_EQ(countLayersOfType(loaded, "Subgraph"), countLayersOfType(imported, "Subgraph"));
+    compareInference(loaded, imported, {{1, 67}});
+}
+
+TEST(ExportImportTest, importedNetworkWithDynamicInputMatchesLoadedNetwork) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeConvReluPool({1, 3, Dimension(8, 32), Dimension(8, 32)})),
+                                 CommonTestUtils::DEVICE_CPU);
+    auto imported = importFromString(ie, exportToString(loaded));
+
+    compareInference(loaded, imported, {{1, 3, 32, 32}, {1, 3, 9, 15}, {1, 3, 8, 8}, {1, 3, 9, 15}});
+
+    // the bounds are imported with the network
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 3, 33, 8}, Layout::NCHW});
+    input->allocate();
+    ASSERT_THROW(imported.CreateInferRequest().SetBlob("param", input), Exception);
+}
+
+TEST(ExportImportTest, networkLoadedFromCacheDirMatchesLoadedNetwork) {
+    const std::string cacheDir = "ExportImportTest_networkLoadedFromCacheDir_cache";
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+
+    Core ie;
+    CNNNetwork network(makeConvReluPool({1, 3, 17, 23}));
+    auto loaded = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    // The first network is exported to the cache, the second one is imported from it
+    ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    const auto cachedCount = CommonTestUtils::listFilesWithExt(cacheDir, "blob").size();
+    auto cached = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+
+    ASSERT_EQ(1, cachedCount);
+    compareInference(loaded, cached, {{1, 3, 17, 23}});
+}
+
+TEST(ExportImportTest, throwsOnWrongFormatVersion) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeConvReluPool({1, 3, 17, 23})), CommonTestUtils::DEVICE_CPU);
+    auto blob = exportToString(loaded);
+
+    // the blob starts with the version of its format
+    std::uint64_t version = 0;
+    std::memcpy(&version, blob.data(), sizeof(version));
+    version++;
+    std::memcpy(&blob[0], &version, sizeof(version));
+    ASSERT_THROW(importFromString(ie, blob), NetworkNotRead);
+}
+
+TEST(ExportImportTest, throwsOnTruncatedBlob) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeConvReluPool({1, 3, 17, 23})), CommonTestUtils::DEVICE_CPU);
+    const auto blob = exportToString(loaded);
+
+    for (size_t size : {blob.size() - 1, blob.size() / 2, sizeof(std::uint64_t) + 3, size_t(0)}) {
+        ASSERT_THROW(importFromString(ie, blob.substr(0, size)), NetworkNotRead) << "size: " << size;
+    }
+}
+
+TEST(ExportImportTest, throwsOnCorruptedBlob) {
+    Core ie;
+    auto loaded = ie.LoadNetwork(CNNNetwork(makeConvReluPool({1, 3, 17, 23})), CommonTestUtils::DEVICE_CPU);
+    const auto blob = exportToString(loaded);
+
+    // a byte of the IR
+    auto corruptedModel = blob;
+    const auto layers = corruptedModel.find("<layers>");
+    ASSERT_NE(std::string::npos, layers);
+    corruptedModel[layers + 1] ^= 0x20;
+    ASSERT_THROW(importFromString(ie, corruptedModel), NetworkNotRead);
+
+    // the count of the inputs which follows the version
+    auto corruptedCount = blob;
+    corruptedCount[sizeof(std::uint64_t) + 6] = '\x7f';
+    ASSERT_THROW(importFromString(ie, corruptedCount), NetworkNotRead);
+}
+
+}  // namespace SubgraphTestsDefinitions
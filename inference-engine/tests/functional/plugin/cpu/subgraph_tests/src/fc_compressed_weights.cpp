@@ -0,0 +1,162 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Param [M, K]  Constant u4/i4 [N, G, K / G] (or [K, N] if not transposed)
+//     \             |
+//      \         Convert -> Subtract(zero points) -> Multiply(scales) -> [Reshape]
+//       \         /
+//         MatMul
+using FCCompressedWeightsParams = std::tuple<element::Type,   // weights precision
+                                             size_t,          // groups number, 0 means not transposed weights with a per output channel group
+                                             size_t,          // M
+                                             size_t,          // N
+                                             size_t>;         // K
+
+class FCCompressedWeightsTest : public testing::TestWithParam<FCCompressedWeightsParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCCompressedWeightsParams> obj) {
+        element::Type weightsType;
+        size_t groups, M, N, K;
+        std::tie(weightsType, groups, M, N, K) = obj.param;
+
+        std::ostringstream result;
+        result << "WP=" << weightsType << "_G=" << groups << "_M=" << M << "_N=" << N << "_K=" << K;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::tie(weightsType, groups, M, N, K) = GetParam();
+        const bool transposed = groups != 0;
+        const size_t groupSize = transposed ? K / groups : K;
+        const int minValue = weightsType == element::i4 ? -8 : 0;
+
+        std::vector<int> rawWeights(N * K);
+        for (size_t i = 0; i < rawWeights.size(); i++)
+            rawWeights[i] = minValue + static_cast<int>((i * 7 + i / 3) % 16);
+
+        const size_t paramsNum = transposed ? N * groups : N;
+        std::vector<float> zeroPoints(paramsNum), scales(paramsNum);
+        for (size_t i = 0; i < paramsNum; i++) {
+            zeroPoints[i] = static_cast<float>(minValue + static_cast<int>(i % 5));
+            scales[i] = 0.01f * static_cast<float>(1 + i % 7);
+        }
+
+        // reference decompressed weights [N, K]
+        decompressedWeights.resize(N * K);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t k = 0; k < K; k++) {
+                const size_t rawIdx = transposed ? n * K + k : k * N + n;
+                const size_t paramIdx = transposed ? n * groups + k / groupSize : n;
+                decompressedWeights[n * K + k] = (rawWeights[rawIdx] - zeroPoints[paramIdx]) * scales[paramIdx];
+            }
+        }
+
+        const Shape weightsShape = transposed ? Shape{N, groups, groupSize} : Shape{K, N};
+        const Shape paramsShape = transposed ? Shape{N, groups, 1} : Shape{1, N};
+        auto param = std::make_shared<opset1::Parameter>(element::f32, Shape{M, K});
+        param->set_friendly_name("param");
+        auto weights = std::make_shared<opset1::Constant>(weightsType, weightsShape, rawWeights);
+        auto convert = std::make_shared<opset1::Convert>(weights, element::f32);
+        auto subtract = std::make_shared<opset1::Subtract>(convert, opset1::Constant::create(element::f32, paramsShape, zeroPoints));
+        auto multiply = std::make_shared<opset1::Multiply>(subtract, opset1::Constant::create(element::f32, paramsShape, scales));
+        std::shared_ptr<Node> decompressed = multiply;
+        if (transposed) {
+            decompressed = std::make_shared<opset1::Reshape>(multiply, opset1::Constant::create(element::i64, Shape{2}, {N, K}), false);
+        }
+        auto matMul = std::make_shared<opset1::MatMul>(param, decompressed, false, transposed);
+        matMul->set_friendly_name("matmul");
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(matMul)}, ParameterVector{param}, "FCCompressedWeights");
+    }
+
+    void CheckOutput(const Blob::Ptr& input, const Blob::Ptr& output, size_t rowsNum) const {
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t m = 0; m < rowsNum; m++) {
+            for (size_t n = 0; n < N; n++) {
+                float expected = 0.f;
+                for (size_t k = 0; k < K; k++)
+                    expected += inputData[m * K + k] * decompressedWeights[n * K + k];
+                ASSERT_NEAR(expected, outputData[m * N + n], 1e-3f * K) << "m: " << m << ", n: " << n;
+            }
+        }
+    }
+
+    element::Type weightsType;
+    size_t groups, M, N, K;
+    std::vector<float> decompressedWeights;
+    std::shared_ptr<Function> function;
+};
+
+TEST_P(FCCompressedWeightsTest, CompareWithRefs) {
+    Core ie;
+    auto execNetwork = ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU);
+
+    // The weights must stay packed, i.e. FullyConnected takes them together with the decompression parameters
+    size_t compressedFCCount = 0;
+    for (const auto &node : execNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto &rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        ASSERT_NE(rtInfo.end(), it);
+        auto layerType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)->get();
+        if (layerType == "FullyConnected" && node->get_input_size() == 5)
+            compressedFCCount++;
+    }
+    ASSERT_EQ(1, compressedFCCount);
+
+    auto request = execNetwork.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, {M, K}, Layout::NC}, 4, -2, 100);
+    request.SetBlob("param", input);
+    request.Infer();
+
+    CheckOutput(input, request.GetBlob("matmul"), M);
+}
+
+// Only the rows up to the dynamic batch limit are computed
+TEST_P(FCCompressedWeightsTest, DynamicBatch) {
+    if (M < 2)
+        GTEST_SKIP() << "the batch can't be reduced";
+
+    Core ie;
+    auto execNetwork = ie.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}});
+    auto request = execNetwork.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, {M, K}, Layout::NC}, 4, -2, 100);
+    request.SetBlob("param", input);
+    for (size_t batch = 1; batch <= M; batch++) {
+        request.SetBatch(static_cast<int>(batch));
+        request.Infer();
+        CheckOutput(input, request.GetBlob("matmul"), batch);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCCompressedWeights, FCCompressedWeightsTest,
+                         ::testing::Combine(::testing::Values(element::u4, element::i4),
+                                            ::testing::Values(0, 1, 4),
+                                            // more than fc_u4_weights_max_rows rows are multiplied by the decompressed weights
+                                            ::testing::Values(1, 5, 37),
+                                            ::testing::Values(16, 33),
+                                            ::testing::Values(64)),
+                         FCCompressedWeightsTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Param -> Relu -> Result
+// The input precision is not natively supported by the plugin, so the data is converted on the infer request side.
+// The test runs several inferences to check that the converted data is refreshed on every call.
+using InputPrecisionConvertParams = std::tuple<Precision,     // input precision
+                                               SizeVector>;   // input shape
+
+class InputPrecisionConvertTest : public testing::WithParamInterface<InputPrecisionConvertParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InputPrecisionConvertParams> obj) {
+        Precision inputPrecision;
+        SizeVector inputShape;
+        std::tie(inputPrecision, inputShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "inPRC=" << inputPrecision.name();
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::tie(inPrc, inputShape) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto relu = std::make_shared<opset5::Relu>(inputParams[0]);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset5::Result>(relu)}, inputParams,
+                                                      "InputPrecisionConvert");
+    }
+
+    void Infer() override {
+        constexpr size_t inferIterations = 3lu;
+
+        for (size_t i = 0; i < inferIterations; ++i) {
+            for (auto& input : inputs) {
+                input = FuncTestUtils::createAndFillBlob(input->getTensorDesc(), 10, 0, 1, i + 1);
+            }
+            LayerTestsCommon::Infer();
+            LayerTestsCommon::Validate();
+        }
+    }
+
+    void Validate() override {
+        // Do nothing. We call Validate() in the Infer() method
+    }
+};
+
+TEST_P(InputPrecisionConvertTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<Precision> inputPrecisions = {
+        Precision::FP16,
+        Precision::I16,
+        Precision::U16,
+        Precision::I64,
+};
+
+const std::vector<SizeVector> inputShapes = {
+        {1, 3, 16, 16},
+        {2, 17},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_InputPrecisionConvert, InputPrecisionConvertTest,
+                         ::testing::Combine(::testing::ValuesIn(inputPrecisions),
+                                            ::testing::ValuesIn(inputShapes)),
+                         InputPrecisionConvertTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
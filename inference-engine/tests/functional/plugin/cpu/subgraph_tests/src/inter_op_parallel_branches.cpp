@@ -0,0 +1,131 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Param -> N x (Convolution -> Relu -> Multiply) -> Concat -> Result
+// The branches are independent, so in the inter-op parallel mode they are executed concurrently
+// and their intermediate tensors must not share memory.
+using InterOpParallelBranchesParams = std::tuple<size_t,         // number of branches
+                                                 std::string>;   // inter-op parallel mode
+
+class InterOpParallelBranchesTest : public testing::WithParamInterface<InterOpParallelBranchesParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InterOpParallelBranchesParams> obj) {
+        size_t numBranches;
+        std::string interOpMode;
+        std::tie(numBranches, interOpMode) = obj.param;
+
+        std::ostringstream result;
+        result << "NUM_BRANCHES=" << numBranches << "_";
+        result << "INTER_OP=" << interOpMode;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t numBranches;
+        std::string interOpMode;
+        std::tie(numBranches, interOpMode) = this->GetParam();
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL, interOpMode});
+
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 16, 10, 10}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        OutputVector branches;
+        for (size_t i = 0; i < numBranches; i++) {
+            auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 op::PadType::EXPLICIT, 8 + i);
+            auto relu = std::make_shared<opset5::Relu>(conv);
+            auto mul = std::make_shared<opset5::Multiply>(relu, opset5::Constant::create(element::f32, Shape{1}, {0.5f * (i + 1)}));
+            branches.push_back(mul);
+        }
+        auto concat = std::make_shared<opset5::Concat>(branches, 1);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset5::Result>(concat)}, inputParams,
+                                                      "InterOpParallelBranches");
+    }
+};
+
+TEST_P(InterOpParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+// Param -> Convolution -> Relu -> Result
+//       -> Reshape -> MatMul -> Result
+// The convolution and the matrix multiplication are executed concurrently, each of them opens its own parallel region
+// and uses the scratchpad of the executing thread, so the results must match the serial execution on every inference.
+TEST(InterOpParallelConcurrencyTest, ConvAndMatMulBranchesMatchSerialExecution) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto inputParams = builder::makeParams(element::f32, {Shape{1, 32, 28, 28}});
+    auto conv = builder::makeConvolution(inputParams[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                         op::PadType::EXPLICIT, 64);
+    auto relu = std::make_shared<opset5::Relu>(conv);
+    auto reshape = std::make_shared<opset5::Reshape>(inputParams[0],
+                                                     opset5::Constant::create(element::i64, Shape{2}, {32, 784}), false);
+    auto weights = builder::makeConstant<float>(element::f32, {784, 256}, {}, true);
+    auto matMul = std::make_shared<opset5::MatMul>(reshape, weights);
+    auto function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset5::Result>(relu),
+                                                                    std::make_shared<opset5::Result>(matMul)},
+                                                       inputParams, "ConvAndMatMulBranches");
+
+    CNNNetwork network(function);
+    auto core = PluginCache::get().ie();
+    auto serialNetwork = core->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                           {{PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO}});
+    auto parallelNetwork = core->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                             {{PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES}});
+    auto serialRequest = serialNetwork.CreateInferRequest();
+    auto parallelRequest = parallelNetwork.CreateInferRequest();
+
+    const auto& inputInfo = *network.getInputsInfo().begin();
+    for (int iteration = 0; iteration < 20; iteration++) {
+        auto input = FuncTestUtils::createAndFillBlob(inputInfo.second->getTensorDesc(), 10, -5, 100, iteration);
+        serialRequest.SetBlob(inputInfo.first, input);
+        parallelRequest.SetBlob(inputInfo.first, input);
+        serialRequest.Infer();
+        parallelRequest.Infer();
+
+        for (const auto& output : network.getOutputsInfo()) {
+            auto expected = as<MemoryBlob>(serialRequest.GetBlob(output.first));
+            auto actual = as<MemoryBlob>(parallelRequest.GetBlob(output.first));
+            ASSERT_NE(nullptr, expected);
+            ASSERT_NE(nullptr, actual);
+            const auto expectedMemory = expected->rmap();
+            const auto actualMemory = actual->rmap();
+            FuncTestUtils::compareRawBuffers(actualMemory.as<const float*>(), expectedMemory.as<const float*>(),
+                                             actual->size(), expected->size(), 1e-4f);
+        }
+    }
+}
+
+namespace {
+
+const std::vector<size_t> numBranches = { 1, 2, 4 };
+const std::vector<std::string> interOpModes = { PluginConfigParams::YES, PluginConfigParams::NO };
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelBranches, InterOpParallelBranchesTest,
+                         ::testing::Combine(::testing::ValuesIn(numBranches),
+                                            ::testing::ValuesIn(interOpModes)),
+                         InterOpParallelBranchesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
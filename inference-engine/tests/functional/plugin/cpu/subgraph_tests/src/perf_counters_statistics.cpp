@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Param -> Convolution -> Relu -> Result
+// With the performance counters enabled the executable graph reports the latency percentiles,
+// the memory traffic and the FLOPs estimation for each executed node.
+class PerfCountersStatisticsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 16, 10, 10}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<opset5::Relu>(conv);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset5::Result>(relu)}, inputParams,
+                                                      "PerfCountersStatistics");
+    }
+};
+
+TEST_F(PerfCountersStatisticsTest, ExecGraphContainsStatistics) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    for (size_t i = 0; i < 10; i++)
+        inferRequest.Infer();
+
+    auto getRtValue = [](const std::shared_ptr<Node>& node, const std::string& key) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(key);
+        if (it == rtInfo.end())
+            IE_THROW() << "Node " << node->get_friendly_name() << " doesn't have " << key << " runtime info";
+        auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+        IE_ASSERT(value != nullptr);
+        return value->get();
+    };
+
+    bool convFound = false;
+    for (const auto &node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        if (getRtValue(node, ExecGraphInfoSerialization::LAYER_TYPE) != "Convolution")
+            continue;
+        convFound = true;
+
+        const double p50 = std::stod(getRtValue(node, ExecGraphInfoSerialization::PERF_COUNTER_P50));
+        const double p90 = std::stod(getRtValue(node, ExecGraphInfoSerialization::PERF_COUNTER_P90));
+        const double p99 = std::stod(getRtValue(node, ExecGraphInfoSerialization::PERF_COUNTER_P99));
+        ASSERT_GT(p50, 0.0);
+        ASSERT_LE(p50, p90);
+        ASSERT_LE(p90, p99);
+
+        // 2 * (1 x 8 x 10 x 10 outputs) * (16 x 3 x 3 multiply-adds per output)
+        ASSERT_EQ(std::stoull(getRtValue(node, ExecGraphInfoSerialization::FLOPS)), 2ull * 800 * 144);
+        // at least the source, weights and destination tensors are accessed
+        const uint64_t minTraffic = (1 * 16 * 10 * 10 + 8 * 16 * 3 * 3 + 1 * 8 * 10 * 10) * sizeof(float);
+        ASSERT_GE(std::stoull(getRtValue(node, ExecGraphInfoSerialization::MEMORY_TRAFFIC)), minTraffic);
+    }
+    ASSERT_TRUE(convFound);
+}
+
+} // namespace SubgraphTestsDefinitions
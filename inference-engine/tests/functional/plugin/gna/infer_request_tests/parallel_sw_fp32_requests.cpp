@@ -0,0 +1,91 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t inputSize = 64;
+constexpr size_t outputSize = 32;
+constexpr size_t requestsNum = 4;
+
+// Param [1, 64] -> MatMul with Constant [64, 32] -> Add -> Relu -> Result
+std::shared_ptr<ngraph::Function> makeAffineRelu() {
+    std::vector<float> weights(inputSize * outputSize), biases(outputSize);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<float>(static_cast<int>(i % 9) - 4) / 16.f;
+    for (size_t i = 0; i < biases.size(); i++)
+        biases[i] = static_cast<float>(i % 5) / 8.f;
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, inputSize});
+    param->set_friendly_name("param");
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(param,
+        ngraph::opset1::Constant::create(ngraph::element::f32, {inputSize, outputSize}, weights), false, false);
+    auto add = std::make_shared<ngraph::opset1::Add>(matMul, ngraph::opset1::Constant::create(ngraph::element::f32, {1, outputSize}, biases));
+    auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+    relu->set_friendly_name("relu");
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                              ngraph::ParameterVector{param}, "AffineRelu");
+}
+
+}  // namespace
+
+// The software requests of the network with several library threads are computed concurrently,
+// every request has to get the same result as the synchronous inference of its input
+TEST(GnaSwFp32InferRequestsTest, parallelAsyncRequestsMatchSyncInference) {
+    Core ie;
+    CNNNetwork network(makeAffineRelu());
+    const std::map<std::string, std::string> config = {
+        {GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_FP32},
+        {GNA_CONFIG_KEY(LIB_N_THREADS), std::to_string(requestsNum)}
+    };
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_GNA, config);
+
+    std::vector<Blob::Ptr> inputs, expected;
+    auto syncRequest = execNetwork.CreateInferRequest();
+    for (size_t r = 0; r < requestsNum; r++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob({Precision::FP32, {1, inputSize}, Layout::NC}, 8, -4, 1,
+                                                          static_cast<int32_t>(r + 1)));
+        syncRequest.SetBlob("param", inputs.back());
+        syncRequest.Infer();
+        auto output = make_shared_blob<float>({Precision::FP32, {1, outputSize}, Layout::NC});
+        output->allocate();
+        auto syncOutput = syncRequest.GetBlob("relu");
+        std::copy_n(syncOutput->cbuffer().as<const float*>(), outputSize, output->buffer().as<float*>());
+        expected.push_back(output);
+    }
+
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < requestsNum; r++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        requests.back().SetBlob("param", inputs[r]);
+    }
+
+    // the requests are started together several times to catch the races between them
+    for (int iteration = 0; iteration < 20; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (size_t r = 0; r < requestsNum; r++) {
+            ASSERT_EQ(StatusCode::OK, requests[r].Wait(InferRequest::WaitMode::RESULT_READY));
+            auto actualData = requests[r].GetBlob("relu")->cbuffer().as<const float*>();
+            auto expectedData = expected[r]->cbuffer().as<const float*>();
+            for (size_t i = 0; i < outputSize; i++) {
+                ASSERT_EQ(expectedData[i], actualData[i]) << "iteration: " << iteration << ", request: " << r << ", index: " << i;
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+#include "ie_core.hpp"
+#include "multi-device/multi_device_config.hpp"
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+// the device is registered under the given name from the plugin library (if the location is not empty)
+// and configured with the given config, so the same plugin may serve as several devices with different performance
+struct MultiSchedulingDevice {
+    std::string _name;
+    std::string _location;
+    std::map<std::string, std::string> _config;
+};
+
+class MultiDevice_SchedulingTest : public CommonTestUtils::TestsCommon,
+                                   public testing::WithParamInterface<std::vector<MultiSchedulingDevice>> {
+    void SetUp() override {
+        auto ie = PluginCache::get().ie();
+        std::vector<std::string> names;
+        for (auto&& device : this->GetParam()) {
+            if (!device._location.empty()) {
+                try {
+                    ie->RegisterPlugin(device._location, device._name);
+                } catch (InferenceEngine::Exception& ex) {
+                    if (std::string{ex.what()}.find("is already registered") == std::string::npos)
+                        throw;
+                }
+            }
+            if (!device._config.empty())
+                ie->SetConfig(device._config, device._name);
+            names.push_back(device._name);
+        }
+        device_names = getDeviceStringWithMulti(names);
+        fn_ptr = ngraph::builder::subgraph::makeSplitMultiConvConcat();
+    }
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::vector<MultiSchedulingDevice>> &obj) {
+        std::vector<std::string> names;
+        for (auto&& device : obj.param)
+            names.push_back(device._name);
+        auto s = getDeviceStringWithMulti(names);
+        std::replace(s.begin(), s.end(), ',', '_');
+        return "device_names_" + s;
+    }
+protected:
+    std::string device_names;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+};
+
+TEST_P(MultiDevice_SchedulingTest, canScheduleByEarliestCompletionAndReportStatistics) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)}});
+    ASSERT_EQ(exec_net.GetConfig(InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>(),
+              MULTI_CONFIG_VALUE(EARLIEST_COMPLETION));
+
+    auto nireq = exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < nireq; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+
+    const size_t iterations = 10;
+    for (size_t it = 0; it < iterations; it++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(request.Wait(InferenceEngine::InferRequest::RESULT_READY), InferenceEngine::StatusCode::OK);
+    }
+
+    using Statistics = std::map<std::string, std::map<std::string, double>>;
+    Statistics statistics;
+    ASSERT_NO_THROW(statistics = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_STATISTICS)).as<Statistics>());
+    ASSERT_EQ(statistics.size(), this->GetParam().size());
+    double completed = 0;
+    for (auto&& device : statistics) {
+        completed += device.second.at("COMPLETED_REQUESTS");
+        ASSERT_EQ(device.second.at("IN_FLIGHT_REQUESTS"), 0);
+        ASSERT_EQ(device.second.at("QUEUED_REQUESTS"), 0);
+        if (device.second.at("COMPLETED_REQUESTS") > 0) {
+            ASSERT_GT(device.second.at("LATENCY_EWMA_MS"), 0);
+            ASSERT_GT(device.second.at("LATENCY_AVG_MS"), 0);
+        }
+    }
+    ASSERT_EQ(completed, static_cast<double>(iterations * nireq));
+}
+
+TEST_P(MultiDevice_SchedulingTest, cannotLoadWithUnknownSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {
+        {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "ROUND_ROBIN"}}), InferenceEngine::Exception);
+}
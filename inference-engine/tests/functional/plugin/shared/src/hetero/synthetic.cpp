@@ -7,6 +7,7 @@
 #include <ngraph/variant.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <map>
 #include <random>
 namespace HeteroTests {
 
@@ -149,4 +150,47 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedRequestsMatchSequentialInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    LoadNetwork();
+
+    // at least two requests are in flight, so the subgraphs of different requests overlap
+    auto nireq = std::max(2u, executableNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < nireq; ++i) {
+        auto request = executableNetwork.CreateInferRequest();
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            request.SetBlob(input.first, FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 10, -5, 1, i + 1));
+        }
+        requests.push_back(request);
+    }
+
+    auto getOutputs = [&] (InferenceEngine::InferRequest& request) {
+        std::map<std::string, std::vector<uint8_t>> outputs;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            auto blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(request.GetBlob(output.first));
+            auto lockedMemory = blob->rmap();
+            auto data = lockedMemory.as<const uint8_t*>();
+            outputs[output.first] = std::vector<uint8_t>(data, data + blob->byteSize());
+        }
+        return outputs;
+    };
+
+    std::vector<std::map<std::string, std::vector<uint8_t>>> expectedOutputs;
+    for (auto&& request : requests) {
+        request.Infer();
+        expectedOutputs.push_back(getOutputs(request));
+    }
+
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (unsigned int i = 0; i < nireq; ++i) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, requests[i].Wait(InferenceEngine::InferRequest::RESULT_READY));
+        ASSERT_EQ(expectedOutputs[i], getOutputs(requests[i])) << "request " << i;
+    }
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/fc_u4_weights.h"
+
+using FcU4WeightsParams = std::tuple<size_t,    // M
+                                     size_t,    // N
+                                     size_t,    // K
+                                     size_t,    // group size
+                                     bool>;     // with bias
+
+class FcU4WeightsTest : public testing::TestWithParam<FcU4WeightsParams> {};
+
+TEST_P(FcU4WeightsTest, MatchesReference) {
+    size_t M, N, K, groupSize;
+    bool withBias;
+    std::tie(M, N, K, groupSize, withBias) = GetParam();
+    const size_t groupsNum = (K + groupSize - 1) / groupSize;
+    const size_t rowStride = (K + 1) / 2;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::uniform_int_distribution<int> nibbles(0, 15);
+
+    std::vector<float> src(M * K), scales(N * groupsNum), zeroPoints(N * groupsNum), bias(N);
+    std::vector<uint8_t> unpacked(N * K), weights(N * rowStride, 0);
+    for (auto& v : src) v = values(gen);
+    for (auto& v : scales) v = values(gen);
+    for (auto& v : zeroPoints) v = static_cast<float>(nibbles(gen));
+    for (auto& v : bias) v = values(gen);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t k = 0; k < K; k++) {
+            unpacked[n * K + k] = static_cast<uint8_t>(nibbles(gen));
+            weights[n * rowStride + k / 2] |= unpacked[n * K + k] << ((k % 2) * 4);
+        }
+    }
+
+    std::vector<float> dst(M * N);
+    MKLDNNPlugin::fc_u4_weights(src.data(), weights.data(), scales.data(), zeroPoints.data(), withBias ? bias.data() : nullptr,
+                                dst.data(), M, N, K, groupSize);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double expected = withBias ? bias[n] : 0.;
+            for (size_t k = 0; k < K; k++) {
+                const size_t g = n * groupsNum + k / groupSize;
+                expected += src[m * K + k] * (unpacked[n * K + k] - zeroPoints[g]) * scales[g];
+            }
+            ASSERT_NEAR(dst[m * N + n], expected, 1e-3) << "m: " << m << ", n: " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FcU4Weights, FcU4WeightsTest,
+                         ::testing::Values(FcU4WeightsParams{1, 64, 128, 32, true},
+                                           FcU4WeightsParams{3, 7, 96, 96, false},
+                                           FcU4WeightsParams{5, 13, 56, 8, true},
+                                           FcU4WeightsParams{2, 4, 33, 11, false},
+                                           FcU4WeightsParams{17, 9, 200, 40, true}));
@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_kernel_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+class KernelCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cache.clear();
+        cache.setCapacity(MKLDNNKernelCache::defaultCapacity);
+    }
+
+    void TearDown() override {
+        cache.clear();
+        cache.setCapacity(MKLDNNKernelCache::defaultCapacity);
+    }
+
+    std::shared_ptr<int> get(int value) {
+        return cache.findOrCreate<int>(MKLDNNKernelKey("test") << value, [&] {
+            created++;
+            return std::make_shared<int>(value);
+        });
+    }
+
+    MKLDNNKernelCache& cache = MKLDNNKernelCache::getInstance();
+    std::atomic<int> created = {0};
+};
+
+TEST_F(KernelCacheTest, reusesKernelWithSameKey) {
+    auto first = get(1);
+    auto second = get(1);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(created, 1);
+    EXPECT_EQ(cache.getMisses(), 1u);
+    EXPECT_EQ(cache.getHits(), 1u);
+}
+
+TEST_F(KernelCacheTest, distinguishesKeys) {
+    EXPECT_NE(get(1), get(2));
+    EXPECT_EQ(created, 2);
+    EXPECT_NE(cache.findOrCreate<int>(MKLDNNKernelKey("test") << 1 << 2, [] { return std::make_shared<int>(0); }),
+              cache.findOrCreate<int>(MKLDNNKernelKey("test") << 1, [] { return std::make_shared<int>(0); }));
+}
+
+TEST_F(KernelCacheTest, evictsLeastRecentlyUsed) {
+    cache.setCapacity(2);
+    get(1);
+    get(2);
+    get(1);
+    get(3);  // evicts 2
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(created, 3);
+    get(1);
+    EXPECT_EQ(created, 3);
+    get(2);
+    EXPECT_EQ(created, 4);
+}
+
+TEST_F(KernelCacheTest, evictedKernelStaysAlive) {
+    cache.setCapacity(1);
+    auto kernel = get(1);
+    get(2);
+    ASSERT_NE(kernel, nullptr);
+    EXPECT_EQ(*kernel, 1);
+}
+
+TEST_F(KernelCacheTest, zeroCapacityDisablesCaching) {
+    cache.setCapacity(0);
+    get(1);
+    get(1);
+    EXPECT_EQ(created, 2);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(KernelCacheTest, doesNotCacheNullKernel) {
+    auto kernel = cache.findOrCreate<int>(MKLDNNKernelKey("test"), [] { return std::shared_ptr<int>(); });
+    EXPECT_EQ(kernel, nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(KernelCacheTest, canBeUsedConcurrently) {
+    std::vector<std::thread> threads;
+    std::vector<std::shared_ptr<int>> kernels(8);
+    for (size_t i = 0; i < kernels.size(); i++) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 100; j++) {
+                kernels[i] = get(j % 10);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.size(), 10u);
+    EXPECT_EQ(cache.getHits() + cache.getMisses(), 800u);
+    for (const auto& kernel : kernels) {
+        EXPECT_EQ(kernel, get(9));
+    }
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <random>
 #include <vector>
 #include <gtest/gtest.h>
 #include <ie_common.h>
@@ -114,7 +115,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,7 +124,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -233,9 +234,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +272,67 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, GapAgainstMaxDepth) {
+    std::vector<Box> boxes{    //  |            __________
+            {6, 7, 3},         //  |   ____    |_3________|
+            {2, 5, 2},         //  |  |_4__|_____ |    |
+            {5, 8, 2},         //  |__|_2________||_1__|___
+            {2, 3, 2},         //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.gap(), 0);
+    EXPECT_EQ(ms.solve() - ms.maxDepth(), ms.gap());
+}
+
+// Edge set of a residual network: every block output lives until the shortcut addition of the next block
+TEST(MemSolverTest, ResidualNetworkArena) {
+    std::vector<Box> boxes;
+    int64_t id = 0;
+    int t = 0;
+    int64_t size = 64 * 56 * 56;
+    for (int stage = 0; stage < 4; stage++, size /= 2) {
+        for (int block = 0; block < 3; block++) {
+            const int block_input = t;
+            boxes.push_back({t, t + 1, size / 4, id++});         // conv 1x1
+            boxes.push_back({t + 1, t + 2, size / 4, id++});     // conv 3x3
+            boxes.push_back({t + 2, t + 3, size, id++});         // conv 1x1
+            boxes.push_back({block_input, t + 3, size, id++});   // shortcut
+            t += 3;
+        }
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    const int64_t arena = ms.solve();
+    RecordProperty("arena", std::to_string(arena));
+    RecordProperty("gap", std::to_string(ms.gap()));
+    EXPECT_EQ(arena, ms.maxDepth());
+}
+
+TEST(MemSolverTest, RandomBoxesHaveNoOverlapping) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> start(0, 200), duration(0, 10), size(1, 1000);
+    std::vector<Box> boxes;
+    for (int64_t id = 0; id < 300; id++) {
+        int s = start(gen);
+        boxes.push_back({s, s + duration(gen), size(gen), id});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    const int64_t arena = ms.solve();
+    EXPECT_GE(arena, ms.maxDepth());
+    EXPECT_EQ(arena - ms.maxDepth(), ms.gap());
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            const Box& box1 = boxes[i];
+            const Box& box2 = boxes[j];
+            const int64_t off1 = ms.getOffset(box1.id);
+            const int64_t off2 = ms.getOffset(box2.id);
+            ASSERT_LE(off1 + box1.size, arena);
+            ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish ||
+                        off1 + box1.size <= off2 || off1 >= off2 + box2.size) << "Box overlapping is detected";
+        }
+    }
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(WeightsCacheTest, hashOfShortDataMatchesXXHash64) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    const char text[] = "Nobody inspects the spammish repetition";
+
+    ASSERT_EQ(hashFunc.hash(nullptr, 0), 0xEF46DB3751D8E999ULL);
+    ASSERT_EQ(hashFunc.hash(reinterpret_cast<const unsigned char*>("abc"), 3), 0x44BC2CF5AD770999ULL);
+    ASSERT_EQ(hashFunc.hash(reinterpret_cast<const unsigned char*>(text), std::strlen(text)), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(WeightsCacheTest, hashOfLargeDataDependsOnEveryChunk) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::vector<unsigned char> data(5 * (1 << 20) + 17);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+
+    const auto reference = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(hashFunc.hash(data.data(), data.size()), reference);
+
+    for (size_t pos : {size_t(0), size_t(1 << 20), data.size() - 1}) {
+        data[pos] ^= 1;
+        ASSERT_NE(hashFunc.hash(data.data(), data.size()), reference) << "position " << pos;
+        data[pos] ^= 1;
+    }
+    ASSERT_NE(hashFunc.hash(data.data(), data.size() - 1), reference);
+}
+
+TEST(WeightsCacheTest, checksumIsIndependentOfContentKeyHash) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::vector<unsigned char> data(3 * (1 << 20) + 5, 0x5A);
+
+    const auto checksum = MKLDNNWeightsSharing::GetContentChecksum(data.data(), data.size());
+    ASSERT_NE(checksum, hashFunc.hash(data.data(), data.size()));
+    ASSERT_EQ(MKLDNNWeightsSharing::GetContentChecksum(data.data(), data.size()), checksum);
+    data[1 << 20] ^= 1;
+    ASSERT_NE(MKLDNNWeightsSharing::GetContentChecksum(data.data(), data.size()), checksum);
+}
+
+TEST(WeightsCacheTest, contentKeyDependsOnDataAndDescriptorsOnly) {
+    std::vector<float> weights(2 * 3 * 4 * 5, 0.5f);
+    std::vector<float> sameWeights(weights);
+    const TensorDesc planar(Precision::FP32, {2, 3, 4, 5}, Layout::NCHW);
+    const mkldnn::memory::desc nchw({2, 3, 4, 5}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nchw);
+    const mkldnn::memory::desc nhwc({2, 3, 4, 5}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::nhwc);
+    const size_t size = weights.size() * sizeof(float);
+
+    const auto key = MKLDNNWeightsSharing::GetContentKey(weights.data(), size, planar, nchw);
+    ASSERT_EQ(MKLDNNWeightsSharing::GetContentKey(sameWeights.data(), size, planar, nchw), key);
+    ASSERT_NE(MKLDNNWeightsSharing::GetContentKey(weights.data(), size, planar, nhwc), key);
+    ASSERT_NE(MKLDNNWeightsSharing::GetContentKey(weights.data(), size, TensorDesc(Precision::FP32, {2, 3, 4, 5}, Layout::NHWC), nchw),
+              key);
+
+    sameWeights.back() = 1.0f;
+    ASSERT_NE(MKLDNNWeightsSharing::GetContentKey(sameWeights.data(), size, planar, nchw), key);
+}
+
+TEST(WeightsCacheTest, sharesMemoryByKey) {
+    MKLDNNWeightsSharing cache;
+    int created = 0;
+    auto create = [&] {
+        created++;
+        return std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    };
+
+    MKLDNNMemoryPtr first = *cache.findOrCreate("key", create);
+    MKLDNNMemoryPtr second = *cache.findOrCreate("key", create);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(created, 1);
+
+    MKLDNNMemoryPtr other = *cache.findOrCreate("other_key", create);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(created, 2);
+}
+
+TEST(WeightsCacheTest, doesNotShareMemoryWithDifferentChecksumOnKeyCollision) {
+    MKLDNNWeightsSharing cache;
+    const mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    const mkldnn::memory::desc desc({8}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::a);
+    int created = 0;
+    auto create = [&](float value) {
+        return [&, value] {
+            created++;
+            MKLDNNMemoryPtr memory = std::make_shared<MKLDNNMemory>(eng);
+            memory->Create(desc);
+            std::fill_n(static_cast<float*>(memory->GetData()), 8, value);
+            return memory;
+        };
+    };
+
+    MKLDNNMemoryPtr first = *cache.findOrCreate("key", create(1.0f), true, 1);
+    MKLDNNMemoryPtr same = *cache.findOrCreate("key", create(1.0f), true, 1);
+    ASSERT_EQ(first, same);
+    // the memory found in the cache is shared without being created again
+    ASSERT_EQ(created, 1);
+
+    MKLDNNMemoryPtr collided = *cache.findOrCreate("key", create(2.0f), true, 2);
+    ASSERT_NE(first, collided);
+    ASSERT_EQ(created, 2);
+    ASSERT_EQ(static_cast<float*>(collided->GetData())[0], 2.0f);
+    ASSERT_EQ(static_cast<float*>(first->GetData())[0], 1.0f);
+
+    MKLDNNMemoryPtr again = *cache.findOrCreate("key", create(1.0f), true, 1);
+    ASSERT_EQ(first, again);
+    ASSERT_EQ(created, 2);
+}
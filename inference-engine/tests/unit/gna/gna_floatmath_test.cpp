@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "runtime/floatmath.h"
+
+namespace {
+
+std::vector<float> randomVector(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> result(size);
+    for (auto &value : result) {
+        value = dist(gen);
+    }
+    return result;
+}
+
+void expectNear(const std::vector<float> &expected, const std::vector<float> &actual, float depth) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-5f * depth) << "at " << i;
+    }
+}
+
+// M, N, K
+using GnaFloatMathParams = std::tuple<int, int, int>;
+
+class GnaFloatMathTest : public ::testing::TestWithParam<GnaFloatMathParams> {
+ protected:
+    void SetUp() override {
+        std::tie(M, N, K) = GetParam();
+    }
+    int M, N, K;
+};
+
+TEST_P(GnaFloatMathTest, SgemmMatchesReference) {
+    const auto A = randomVector(M * K, 1);
+    const auto B = randomVector(K * N, 2);
+    auto C = randomVector(M * N, 3);
+    auto expected = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            double sum = expected[i * N + j];
+            for (int k = 0; k < K; k++) {
+                sum += static_cast<double>(A[i * K + k]) * B[k * N + j];
+            }
+            expected[i * N + j] = static_cast<float>(sum);
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+    expectNear(expected, C, static_cast<float>(K));
+}
+
+TEST_P(GnaFloatMathTest, SgemmSubsetMatchesReference) {
+    const auto A = randomVector(M * K, 4);
+    const auto B = randomVector(K * N, 5);
+    std::vector<uint32_t> list;
+    for (int i = M - 1; i >= 0; i -= 3) {
+        list.push_back(i);
+    }
+    const int L = static_cast<int>(list.size());
+    auto C = randomVector(L * N, 6);
+    auto expected = C;
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            double sum = expected[l * N + j];
+            for (int k = 0; k < K; k++) {
+                sum += static_cast<double>(A[list[l] * K + k]) * B[k * N + j];
+            }
+            expected[l * N + j] = static_cast<float>(sum);
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N,
+                       list.data(), L);
+    expectNear(expected, C, static_cast<float>(K));
+}
+
+TEST_P(GnaFloatMathTest, SgemvSplitMatchesReference) {
+    const uint32_t K1 = K, K2 = N;
+    const auto A1 = randomVector(K1, 7);
+    const auto A2 = randomVector(K2, 8);
+    const auto X = randomVector(M * (K1 + K2), 9);
+    const auto B = randomVector(M, 10);
+    std::vector<float> C(M), expected(M);
+    for (int i = 0; i < M; i++) {
+        double sum = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            sum += static_cast<double>(A1[j]) * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = 0; j < K2; j++) {
+            sum += static_cast<double>(A2[j]) * X[i * (K1 + K2) + K1 + j];
+        }
+        expected[i] = static_cast<float>(sum);
+    }
+
+    sgemv_split(M, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    expectNear(expected, C, static_cast<float>(K1 + K2));
+}
+
+INSTANTIATE_TEST_SUITE_P(GnaFloatMath, GnaFloatMathTest,
+                         ::testing::Values(GnaFloatMathParams{1, 1, 1},
+                                           GnaFloatMathParams{7, 1, 33},
+                                           GnaFloatMathParams{64, 3, 440},
+                                           GnaFloatMathParams{129, 8, 17},
+                                           GnaFloatMathParams{1024, 5, 1024}));
+
+}  // namespace
@@ -10,6 +10,7 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
@@ -349,6 +350,69 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    auto changeConstant = [&](CNNNetwork& cnnNet, int8_t value) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "add_constant") {
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name("add_constant");
+                ngraph::replace_node(op, constant);
+            }
+        }
+    };
+    changeConstant(net2, 5);
+    changeConstant(net3, 5);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentLargeConstants) {
+    // Constant data is hashed by chunks, make sure that every chunk affects the result
+    auto createLargeNetwork = [](size_t changedIdx) {
+        const size_t size = 3 * 1024 * 1024 + 17;
+        std::vector<uint8_t> values(size, 1);
+        if (changedIdx < size) {
+            values[changedIdx] = 2;
+        }
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::u8, ngraph::Shape{size});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::u8, ngraph::Shape{size}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createLargeNetwork(-1);
+    auto net2 = createLargeNetwork(-1);
+    auto net3 = createLargeNetwork(2 * 1024 * 1024 + 5);
+    auto net4 = createLargeNetwork(3 * 1024 * 1024 + 16);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net4, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto createNetworkWithAxis = [](int64_t axis) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{2, 2});
+        auto softmax = std::make_shared<ngraph::opset6::Softmax>(data, axis);
+        auto res = std::make_shared<ngraph::opset6::Result>(softmax);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createNetworkWithAxis(0);
+    auto net2 = createNetworkWithAxis(1);
+    auto net3 = createNetworkWithAxis(1);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_blob.h"
+#include "mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    const std::string fileName = "mmap_allocator_test.bin";
+    const std::string content = "0123456789abcdef";
+};
+
+TEST_F(MmapAllocatorTests, canMapFile) {
+    auto allocator = CreateMmapAllocator(fileName);
+    void* handle = allocator->alloc(content.size());
+    ASSERT_NE(handle, nullptr);
+    auto data = static_cast<const char*>(allocator->lock(handle, LOCK_FOR_READ));
+    EXPECT_EQ(std::string(data, content.size()), content);
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, canMapFilePrefix) {
+    auto allocator = CreateMmapAllocator(fileName);
+    void* handle = allocator->alloc(4);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(std::string(static_cast<const char*>(handle), 4), content.substr(0, 4));
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    auto allocator = CreateMmapAllocator(fileName);
+    EXPECT_EQ(allocator->alloc(content.size() + 1), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, cannotMapNotExistingFile) {
+    auto allocator = CreateMmapAllocator(fileName + ".not_existing");
+    EXPECT_EQ(allocator->alloc(1), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, modificationDoesNotChangeFile) {
+    {
+        auto allocator = CreateMmapAllocator(fileName);
+        void* handle = allocator->alloc(content.size());
+        ASSERT_NE(handle, nullptr);
+        static_cast<char*>(allocator->lock(handle))[0] = 'X';
+        EXPECT_TRUE(allocator->free(handle));
+    }
+    std::ifstream file(fileName, std::ios::binary);
+    std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(fileContent, content);
+}
+
+TEST_F(MmapAllocatorTests, canCreateBlob) {
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, { content.size() }, Layout::C}, CreateMmapAllocator(fileName));
+    blob->allocate();
+    ASSERT_NE(blob->cbuffer(), nullptr);
+    EXPECT_EQ(std::string(blob->cbuffer().as<const char*>(), content.size()), content);
+}
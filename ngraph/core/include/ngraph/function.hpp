@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,6 +124,9 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes in topological order. The order is cached and is recomputed
+        /// only after a change of the graph connectivity or of the function
+        /// results/sinks/parameters.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -253,11 +257,20 @@ namespace ngraph
         /// function and registers them, otherwise checks all the Parameters are registered.
         void prerequirements(bool detect_variables, bool detect_parameters);
 
+        /// \brief Drops the cached topological order after a change of the function roots
+        void invalidate_topological_cache() { *m_topological_cache_valid = false; }
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+        // cached result of get_ordered_ops(), the flag is shared with the sorted nodes which reset
+        // it on any change of their inputs or control dependencies
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        std::shared_ptr<std::atomic<bool>> m_topological_cache_valid =
+            std::make_shared<std::atomic<bool>>(false);
+        mutable std::mutex m_topological_sort_mutex;
 
         ResultVector m_results;
         // List of the nodes with side effect in graph.
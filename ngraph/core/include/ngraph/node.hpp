@@ -125,9 +125,12 @@ namespace ngraph
     /// or a (possibly empty) tuple of values.
     class NGRAPH_API Node : public std::enable_shared_from_this<Node>
     {
-        // For access to m_outputs.
+        // For access to m_outputs and invalidate_topological_cache().
         friend class descriptor::Input;
 
+        // For access to register_topological_cache().
+        friend class Function;
+
         // For access to m_inputs and m_outputs.
         template <typename NodeType>
         friend class Input;
@@ -493,6 +496,11 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Subscribes the node to the validity flag of a topological order cached by a
+        /// Function, the flag is reset on any change of the node inputs or control dependencies.
+        void register_topological_cache(const std::shared_ptr<std::atomic<bool>>& valid);
+        void invalidate_topological_cache();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -502,6 +510,10 @@ namespace ngraph
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
+        // validity flags of the topological orders cached by the functions containing the node,
+        // declared before m_inputs as the inputs reset them on destruction
+        std::vector<std::weak_ptr<std::atomic<bool>>> m_topological_cache_flags;
+        std::atomic_flag m_topological_cache_flags_lock = ATOMIC_FLAG_INIT;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
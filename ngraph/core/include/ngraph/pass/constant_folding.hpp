@@ -14,11 +14,24 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *        Independent nodes with constant inputs are evaluated concurrently, large
+         *        elementwise operations are additionally split into chunks between threads.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+
+            /// \brief Constructs the pass.
+            /// \param max_threads Limits the threads folding the constants: the pass runs on its
+            /// calling thread and up to `max_threads - 1` helper threads. 0 (the default) means the
+            /// number of the hardware threads. The helpers of all the concurrently running passes
+            /// are additionally limited by the number of the hardware threads together.
+            explicit ConstantFolding(size_t max_threads = 0)
+                : m_max_threads(max_threads)
+            {
+            }
+
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
@@ -27,6 +40,8 @@ namespace ngraph
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+
+            size_t m_max_threads;
         };
     } // namespace pass
 } // namespace ngraph
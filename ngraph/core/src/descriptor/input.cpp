@@ -38,6 +38,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    m_node->invalidate_topological_cache();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
@@ -64,6 +65,7 @@ void descriptor::Input::remove_output()
 {
     if (m_output != nullptr)
     {
+        m_node->invalidate_topological_cache();
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
@@ -215,7 +215,10 @@ void Function::prerequirements(bool detect_variables, bool detect_parameters)
 
     const auto& ordered_ops = get_ordered_ops();
     if (detect_parameters)
+    {
         m_parameters = auto_detect_parameters(ordered_ops);
+        invalidate_topological_cache();
+    }
     else
         check_all_parameters_registered(ordered_ops, m_parameters);
 
@@ -280,6 +283,28 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_topological_sort_mutex);
+    if (*m_topological_cache_valid)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (const auto& node : m_cached_ordered_ops)
+        {
+            if (auto locked_node = node.lock())
+            {
+                ordered_ops.push_back(locked_node);
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (ordered_ops.size() == m_cached_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -294,7 +319,14 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    *m_topological_cache_valid = true;
+    for (const auto& node : ordered_ops)
+    {
+        node->register_topological_cache(m_topological_cache_valid);
+    }
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -458,11 +490,14 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_topological_cache();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
+    std::lock_guard<std::mutex> lock(m_topological_sort_mutex);
     m_topological_sorter = sorter;
+    invalidate_topological_cache();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -540,12 +575,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_topological_cache();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_topological_cache();
     for (const auto& sink : sinks)
     {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink))
@@ -565,11 +602,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -579,6 +618,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -595,6 +635,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -604,6 +645,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_variables(const VariableVector& variables)
@@ -3,6 +3,7 @@
 //
 
 #include <memory>
+#include <thread>
 #include <ngraph/validation_util.hpp>
 #include <sstream>
 #include <typeindex>
@@ -22,6 +23,31 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+namespace
+{
+    // nodes may be shared between functions which are sorted and modified concurrently, so the list
+    // of the topological cache flags is guarded by the lock of its node. The lock is held only to walk
+    // a few weak pointers, so waiting for it spins instead of sleeping on a mutex
+    class SpinLockGuard
+    {
+    public:
+        explicit SpinLockGuard(atomic_flag& flag)
+            : m_flag(flag)
+        {
+            while (m_flag.test_and_set(memory_order_acquire))
+            {
+                this_thread::yield();
+            }
+        }
+        ~SpinLockGuard() { m_flag.clear(memory_order_release); }
+        SpinLockGuard(const SpinLockGuard&) = delete;
+        SpinLockGuard& operator=(const SpinLockGuard&) = delete;
+
+    private:
+        atomic_flag& m_flag;
+    };
+} // namespace
+
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
@@ -31,6 +57,7 @@ Node::Node(const Node& node)
     // skip m_unique_name -- will be generated automatically
     , m_provenance_tags(node.m_provenance_tags)
     , m_provenance_group(node.m_provenance_group)
+    // skip m_topological_cache_flags -- the copy doesn't belong to any function yet
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -46,6 +73,7 @@ Node::Node(const Node& node)
 
 Node& Node::operator=(const Node& node)
 {
+    invalidate_topological_cache();
     this->m_control_dependents = node.m_control_dependents;
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
@@ -182,6 +210,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    invalidate_topological_cache();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -472,6 +501,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        invalidate_topological_cache();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -510,6 +540,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topological_cache();
         }
     }
     {
@@ -531,6 +562,10 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty())
+    {
+        invalidate_topological_cache();
+    }
     m_control_dependencies.clear();
 }
 
@@ -542,6 +577,38 @@ void Node::clear_control_dependents()
     }
 }
 
+void Node::register_topological_cache(const std::shared_ptr<std::atomic<bool>>& valid)
+{
+    SpinLockGuard lock(m_topological_cache_flags_lock);
+    // drop the flags of the destroyed functions so they don't pile up on long-living nodes
+    bool registered = false;
+    m_topological_cache_flags.erase(
+        remove_if(m_topological_cache_flags.begin(),
+                  m_topological_cache_flags.end(),
+                  [&](const weak_ptr<atomic<bool>>& flag) {
+                      auto locked = flag.lock();
+                      registered = registered || locked == valid;
+                      return !locked;
+                  }),
+        m_topological_cache_flags.end());
+    if (!registered)
+    {
+        m_topological_cache_flags.push_back(valid);
+    }
+}
+
+void Node::invalidate_topological_cache()
+{
+    SpinLockGuard lock(m_topological_cache_flags_lock);
+    for (const auto& flag : m_topological_cache_flags)
+    {
+        if (auto valid = flag.lock())
+        {
+            *valid = false;
+        }
+    }
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
@@ -1003,8 +1070,13 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     HostTensorVector input_tensors;
     for (const auto& input : input_values)
     {
+        // evaluate() doesn't modify the inputs, so the tensors share the constants data
+        // instead of holding a copy of every folded weight
+        auto constant = as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr());
         auto host_tensor = make_shared<runtime::HostTensor>(
-            as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr()));
+            constant->get_element_type(),
+            constant->get_shape(),
+            const_cast<void*>(constant->get_data_ptr()));
         input_tensors.push_back(host_tensor);
     }
     HostTensorVector output_tensors;
@@ -3,67 +3,450 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <atomic>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
-bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
+namespace
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    // levels with less output elements are folded sequentially, the threads cost more
+    // than the evaluation itself
+    constexpr size_t parallel_fold_min_elements = 1 << 16;
+    // number of elements evaluated by a single task of a split elementwise fold
+    constexpr size_t elementwise_fold_chunk_size = 1 << 18;
 
-    for (const auto& node : f->get_ordered_ops())
+    struct FoldResult
     {
-        if (rewritten)
+        OutputVector replacements;
+        bool evaluated = false;
+        bool folded = false;
+        exception_ptr error;
+    };
+
+    // helper threads started by all the passes which are running now
+    atomic<size_t> busy_helper_threads{0};
+
+    size_t hardware_threads() { return max<size_t>(thread::hardware_concurrency(), 1); }
+
+    /// \brief Returns the threads limit of a pass, 0 stands for the number of the hardware threads
+    size_t folding_threads_limit(size_t max_threads)
+    {
+        return max_threads != 0 ? max_threads : hardware_threads();
+    }
+
+    /// \brief Reserves up to `wanted` helper threads, the pass gets at most `max_threads - 1`
+    /// of them. The helpers of all the concurrently running passes are limited together by the
+    /// hardware threads, so the functions folded from several threads don't oversubscribe the CPU.
+    size_t acquire_helper_threads(size_t wanted, size_t max_threads)
+    {
+        const size_t limit = hardware_threads() - 1;
+        wanted = min(wanted, folding_threads_limit(max_threads) - 1);
+        size_t busy = busy_helper_threads.load();
+        size_t granted = 0;
+        do
+        {
+            granted = busy < limit ? min(wanted, limit - busy) : 0;
+            if (granted == 0)
+            {
+                return 0;
+            }
+        } while (!busy_helper_threads.compare_exchange_weak(busy, busy + granted));
+        return granted;
+    }
+
+    /// \brief Runs task(0) ... task(count - 1) on the calling thread and the helper threads
+    /// available within the limit. The tasks must not throw.
+    void parallel_run(size_t count, size_t max_threads, const function<void(size_t)>& task)
+    {
+        const size_t helpers = count > 1 ? acquire_helper_threads(count - 1, max_threads) : 0;
+        atomic<size_t> next{0};
+        auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                task(i);
+            }
+        };
+        vector<thread> threads;
+        threads.reserve(helpers);
+        try
+        {
+            for (size_t i = 0; i < helpers; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+        }
+        catch (const system_error&)
+        {
+            // the tasks are shared dynamically, so the started threads and the caller finish them
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        busy_helper_threads -= helpers;
+    }
+
+    /// \brief Groups the ordered nodes by the length of the longest path from the function
+    /// inputs, so the nodes of a group don't depend on each other.
+    vector<NodeVector> split_by_levels(const NodeVector& ordered_ops)
+    {
+        unordered_map<Node*, size_t> levels;
+        vector<NodeVector> nodes_by_level;
+        for (const auto& node : ordered_ops)
+        {
+            size_t level = 0;
+            auto update_level = [&](Node* dependency) {
+                auto it = levels.find(dependency);
+                if (it != levels.end())
+                {
+                    level = max(level, it->second + 1);
+                }
+            };
+            for (const auto& input : node->input_values())
+            {
+                update_level(input.get_node());
+            }
+            for (const auto& dependency : node->get_control_dependencies())
+            {
+                update_level(dependency.get());
+            }
+            levels[node.get()] = level;
+            if (nodes_by_level.size() <= level)
+            {
+                nodes_by_level.resize(level + 1);
+            }
+            nodes_by_level[level].push_back(node);
+        }
+        return nodes_by_level;
+    }
+
+    bool has_constant_inputs(const shared_ptr<Node>& node)
+    {
+        const auto& input_values = node->input_values();
+        return !input_values.empty() &&
+               all_of(input_values.begin(), input_values.end(), [](const Output<Node>& input) {
+                   return is_type<op::Constant>(input.get_node());
+               });
+    }
+
+    size_t output_elements(const shared_ptr<Node>& node)
+    {
+        size_t elements = 0;
+        for (const auto& output : node->outputs())
+        {
+            if (output.get_partial_shape().is_static())
+            {
+                elements += shape_size(output.get_shape());
+            }
+        }
+        return elements;
+    }
+
+    bool is_whole_bytes(const element::Type& type)
+    {
+        return type.is_static() && type.bitwidth() % 8 == 0;
+    }
+
+    /// \brief Checks that the node output is big enough to be evaluated by chunks and every
+    /// chunk can be evaluated by a copy of the node applied to the corresponding input chunks.
+    bool is_splittable_elementwise(const shared_ptr<Node>& node)
+    {
+        const bool is_unary = is_type<op::v0::Convert>(node) ||
+                              dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node);
+        const bool is_binary =
+            dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+            dynamic_pointer_cast<op::util::BinaryElementwiseComparison>(node) ||
+            dynamic_pointer_cast<op::util::BinaryElementwiseLogical>(node);
+        if (!(is_unary || is_binary) || node->get_rt_info().count("DISABLED_CONSTANT_FOLDING") ||
+            !node->has_evaluate() || node->get_output_partial_shape(0).is_dynamic() ||
+            !is_whole_bytes(node->get_output_element_type(0)))
+        {
+            return false;
+        }
+        const auto& shape = node->get_output_shape(0);
+        if (shape_size(shape) < 2 * elementwise_fold_chunk_size)
+        {
+            return false;
+        }
+        // scalars are passed to every chunk as is, so they must be broadcasted implicitly
+        const bool scalars_allowed =
+            is_binary && node->get_autob().m_type == op::AutoBroadcastType::NUMPY;
+        for (const auto& input : node->input_values())
+        {
+            if (!is_whole_bytes(input.get_element_type()) || input.get_partial_shape().is_dynamic())
+            {
+                return false;
+            }
+            const auto& input_shape = input.get_shape();
+            if (input_shape != shape && !(scalars_allowed && shape_size(input_shape) == 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Evaluates the [begin, end) elements of the elementwise node output
+    bool evaluate_chunk(const shared_ptr<Node>& node,
+                        const HostTensorPtr& output,
+                        size_t begin,
+                        size_t end)
+    {
+        OutputVector chunk_inputs;
+        HostTensorVector input_tensors;
+        for (const auto& input : node->input_values())
+        {
+            auto constant = as_type_ptr<op::Constant>(input.get_node_shared_ptr());
+            const auto& type = constant->get_element_type();
+            auto data = static_cast<const char*>(constant->get_data_ptr());
+            auto shape = constant->get_shape();
+            if (shape_size(shape) != 1)
+            {
+                data += begin * type.size();
+                shape = Shape{end - begin};
+            }
+            chunk_inputs.push_back(make_shared<op::Parameter>(type, shape));
+            input_tensors.push_back(
+                make_shared<HostTensor>(type, shape, const_cast<char*>(data)));
+        }
+        auto chunk_node = node->clone_with_new_inputs(chunk_inputs);
+        const auto& type = output->get_element_type();
+        auto data = static_cast<char*>(output->get_data_ptr()) + begin * type.size();
+        HostTensorVector output_tensors{
+            make_shared<HostTensor>(type, chunk_node->get_output_shape(0), data)};
+        return chunk_node->evaluate(output_tensors, input_tensors);
+    }
+
+    /// \brief Folds the nodes with constant inputs on multiple threads. The nodes which are not
+    /// evaluated here are left for the sequential folding.
+    vector<FoldResult> fold_concurrently(const NodeVector& nodes, size_t max_threads)
+    {
+        vector<FoldResult> results(nodes.size());
+        vector<size_t> candidates;
+        size_t elements = 0;
+        for (size_t i = 0; i < nodes.size(); ++i)
         {
-            node->validate_and_infer_types();
+            if (has_constant_inputs(nodes[i]))
+            {
+                candidates.push_back(i);
+                elements += output_elements(nodes[i]);
+            }
+        }
+        if (elements < parallel_fold_min_elements || folding_threads_limit(max_threads) < 2)
+        {
+            return results;
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        while (!candidates.empty())
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            // nodes of a batch don't share the producers, so the constant_fold() overrides that
+            // reshape or reconnect their input constants don't race
+            vector<size_t> batch;
+            vector<size_t> deferred;
+            unordered_set<Node*> producers;
+            for (auto i : candidates)
+            {
+                const auto input_values = nodes[i]->input_values();
+                auto is_shared = [&](const Output<Node>& input) {
+                    return producers.count(input.get_node()) != 0;
+                };
+                if (any_of(input_values.begin(), input_values.end(), is_shared))
+                {
+                    deferred.push_back(i);
+                    continue;
+                }
+                for (const auto& input : input_values)
+                {
+                    producers.insert(input.get_node());
+                }
+                batch.push_back(i);
+            }
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+            // (node index, chunk begin, chunk end), the whole node is folded if the end is 0
+            vector<tuple<size_t, size_t, size_t>> tasks;
+            unordered_map<size_t, HostTensorPtr> split_outputs;
+            for (auto i : batch)
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                const auto& node = nodes[i];
+                if (is_splittable_elementwise(node))
                 {
-                    if (replacements.size() == 1)
+                    const auto size = shape_size(node->get_output_shape(0));
+                    split_outputs[i] = make_shared<HostTensor>(node->get_output_element_type(0),
+                                                               node->get_output_shape(0));
+                    for (size_t begin = 0; begin < size; begin += elementwise_fold_chunk_size)
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
+                        tasks.emplace_back(
+                            i, begin, min(begin + elementwise_fold_chunk_size, size));
                     }
-                    else
+                }
+                else
+                {
+                    tasks.emplace_back(i, 0, 0);
+                }
+            }
+
+            vector<char> chunk_evaluated(tasks.size(), false);
+            parallel_run(tasks.size(), max_threads, [&](size_t task) {
+                size_t i, begin, end;
+                tie(i, begin, end) = tasks[task];
+                const auto& node = nodes[i];
+                if (end == 0)
+                {
+                    auto& result = results[i];
+                    try
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
+                        result.replacements.resize(node->get_output_size());
+                        result.folded =
+                            node->constant_fold(result.replacements, node->input_values());
                     }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+                    catch (...)
+                    {
+                        result.error = current_exception();
+                    }
+                    result.evaluated = true;
+                    return;
+                }
+                try
+                {
+                    chunk_evaluated[task] = evaluate_chunk(node, split_outputs.at(i), begin, end);
+                }
+                catch (...)
+                {
+                    // the node is folded again sequentially to report the error
+                }
+            });
 
-                    rewritten = true;
+            for (size_t task = 0; task < tasks.size();)
+            {
+                const auto i = get<0>(tasks[task]);
+                if (get<2>(tasks[task]) == 0)
+                {
+                    ++task;
+                    continue;
+                }
+                bool evaluated = true;
+                for (; task < tasks.size() && get<0>(tasks[task]) == i; ++task)
+                {
+                    evaluated = evaluated && chunk_evaluated[task];
+                }
+                if (evaluated)
+                {
+                    results[i].replacements = {make_shared<op::Constant>(split_outputs[i])};
+                    results[i].folded = true;
+                    results[i].evaluated = true;
                 }
             }
+
+            candidates.swap(deferred);
+        }
+        return results;
+    }
+} // namespace
+
+bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
+{
+    bool rewritten = pre_calculated_values_folding(f);
+
+    // nodes of the same level are independent, so they are evaluated concurrently and replaced
+    // before the next level is visited
+    for (auto& level : split_by_levels(f->get_ordered_ops()))
+    {
+        if (rewritten)
+        {
+            for (const auto& node : level)
+            {
+                node->validate_and_infer_types();
+            }
         }
-        else
+
+        auto results = fold_concurrently(level, m_max_threads);
+        for (size_t node_idx = 0; node_idx < level.size(); ++node_idx)
         {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            auto& node = level[node_idx];
+            auto& result = results[node_idx];
+            if (result.error)
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                rethrow_exception(result.error);
+            }
+
+            OutputVector replacements(node->get_output_size());
+            bool folded = false;
+            if (result.evaluated)
+            {
+                replacements = move(result.replacements);
+                folded = result.folded;
+            }
+            else
+            {
+                folded = node->constant_fold(replacements, node->input_values());
+            }
+
+            if (folded)
+            {
+                NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < replacements.size(); ++i)
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                    {
+                        if (replacements.size() == 1)
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name());
+                        }
+                        else
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name() + "." + std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
+
+                        rewritten = true;
+                    }
                 }
             }
+            else
+            {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator,
+                // Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+                {
+                    if (const auto& sub_graph = sub_graph_node->get_function())
+                    {
+                        rewritten |= run_on_function(sub_graph);
+                    }
+                }
+            }
+
+            // the replaced nodes and the intermediate constants they hold are released here
+            // instead of the end of the pass
+            node.reset();
+            result = FoldResult();
         }
     }
 
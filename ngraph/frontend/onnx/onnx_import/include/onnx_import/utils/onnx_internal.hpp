@@ -38,6 +38,22 @@ namespace ngraph
             /// graph.
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path);
+
+            /// \brief      Imports and converts an serialized ONNX model from a ModelProto
+            ///             to an nGraph Function representation.
+            ///
+            /// \note       Unlike the overload above, the ModelProto isn't copied. The created
+            ///             Constants reference the initializers data stored in the ModelProto,
+            ///             so it is kept alive as long as the function needs it.
+            ///
+            /// \param[in]  model_proto Shared pointer to a ModelProto object.
+            /// \param[in]  model_path  The path to the imported onnx model.
+            ///
+            /// \return     An nGraph function that represents a single output from the created
+            /// graph.
+            std::shared_ptr<Function>
+                import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
+                                  const std::string& model_path);
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
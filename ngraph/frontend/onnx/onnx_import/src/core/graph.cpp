@@ -68,7 +68,7 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_model_proto()};
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
@@ -32,7 +32,7 @@ namespace ngraph
             throw ngraph_error("Couldn't find operator set's version for domain: " + domain + ".");
         }
 
-        Model::Model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto)
+        Model::Model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
             : m_model_proto{std::move(model_proto)}
         {
             // Walk through the elements of opset_import field and register operator sets
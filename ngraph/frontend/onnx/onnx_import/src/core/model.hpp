@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -28,7 +29,7 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto);
+            explicit Model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto);
 
             Model(const Model&) = delete;
             Model(Model&&) = delete;
@@ -38,6 +39,12 @@ namespace ngraph
 
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
+            /// \brief Shared ownership of the model protobuf. The Constants created from
+            ///        initializers keep it alive as they reference its raw data in place.
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> get_model_proto() const
+            {
+                return m_model_proto;
+            }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const OpsetImports& get_opset_imports() const;
             const std::string& get_producer_version() const
@@ -71,7 +78,7 @@ namespace ngraph
             void enable_opset_domain(const std::string& domain);
 
         private:
-            const std::unique_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+            const std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
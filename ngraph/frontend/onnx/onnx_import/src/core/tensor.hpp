@@ -5,11 +5,14 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -121,16 +124,25 @@ namespace ngraph
                         }
 
                         template <typename T>
-                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                        inline std::vector<T> __get_raw_data(const char* raw_data,
+                                                             size_t raw_data_size,
                                                              int onnx_data_type)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
+                            auto it = reinterpret_cast<const T*>(raw_data);
                             return std::vector<T>(
                                 it,
-                                it + (raw_data.size() /
+                                it + (raw_data_size /
                                       onnx_common::get_onnx_data_size(onnx_data_type)));
                         }
 
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                                                             int onnx_data_type)
+                        {
+                            return __get_raw_data<T>(
+                                raw_data.data(), raw_data.size(), onnx_data_type);
+                        }
+
                         template <typename T>
                         inline std::vector<T>
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -138,7 +150,8 @@ namespace ngraph
                             const auto tensor_external_data = TensorExternalData(tensor);
                             const auto raw_data = tensor_external_data.load_external_data();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            return detail::__get_raw_data<T>(
+                                raw_data->get_ptr<char>(), raw_data->size(), tensor.data_type());
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -482,8 +495,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor       The tensor protobuf.
+            /// \param model_proto  The owner of the tensor protobuf. When given, the Constant
+            ///                     created from the tensor references its raw data in place
+            ///                     and keeps the owner alive instead of copying the data.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -606,11 +625,59 @@ namespace ngraph
             }
 
         private:
+            using SharedData = runtime::SharedBuffer<std::shared_ptr<const void>>;
+
+            /// \brief  Returns the tensor data without copying it: either the raw data of the
+            ///         tensor protobuf kept alive by the model or the mapped external data.
+            ///
+            /// \return The shared data or nullptr if the data has to be converted, e.g. it is
+            ///         stored in the typed fields, is misaligned or doesn't match the shape
+            ///         exactly.
+            std::shared_ptr<SharedData> get_shared_data(size_t element_size) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+
+                std::shared_ptr<const void> owner;
+                const char* data = nullptr;
+                size_t size = 0;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    const auto external_data =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_data();
+                    data = external_data->get_ptr<char>();
+                    size = external_data->size();
+                    owner = external_data;
+                }
+                else if (m_model_proto != nullptr && m_tensor_proto->has_raw_data())
+                {
+                    data = m_tensor_proto->raw_data().data();
+                    size = m_tensor_proto->raw_data().size();
+                    owner = m_model_proto;
+                }
+
+                if (owner == nullptr || size == 0 || size != shape_size(m_shape) * element_size ||
+                    reinterpret_cast<uintptr_t>(data) % element_size != 0)
+                {
+                    return nullptr;
+                }
+                return std::make_shared<SharedData>(const_cast<char*>(data), size, owner);
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (const auto data = get_shared_data(sizeof(T)))
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -619,6 +686,7 @@ namespace ngraph
             }
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
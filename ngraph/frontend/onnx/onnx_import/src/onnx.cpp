@@ -19,9 +19,12 @@ namespace ngraph
         std::shared_ptr<Function> import_onnx_model(std::istream& stream,
                                                     const std::string& model_path)
         {
-            ONNX_NAMESPACE::ModelProto model_proto{onnx_common::parse_from_istream(stream)};
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
+            // swap rather than copy the parsed model, it may hold gigabytes of initializers
+            auto parsed_model_proto = onnx_common::parse_from_istream(stream);
+            model_proto->Swap(&parsed_model_proto);
 
-            return detail::import_onnx_model(model_proto, model_path);
+            return detail::import_onnx_model(std::move(model_proto), model_path);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
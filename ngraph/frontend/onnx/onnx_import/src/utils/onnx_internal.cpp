@@ -94,18 +94,36 @@ namespace ngraph
                 remove_dangling_results(function);
             }
 
-            std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
-                                                        const std::string& model_path)
+            static void apply_transformations(ONNX_NAMESPACE::ModelProto& model_proto,
+                                              const std::string& model_path)
             {
                 transform::expand_onnx_functions(model_proto);
                 transform::fixup_legacy_operators(model_proto);
                 transform::update_external_data_paths(model_proto, model_path);
+            }
 
-                auto p_model_proto = common::make_unique<ONNX_NAMESPACE::ModelProto>(model_proto);
-                auto model = common::make_unique<Model>(std::move(p_model_proto));
+            static std::shared_ptr<Function>
+                convert_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
+            {
+                auto model = common::make_unique<Model>(std::move(model_proto));
                 Graph graph{std::move(model)};
                 return graph.convert();
             }
+
+            std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
+                                                        const std::string& model_path)
+            {
+                apply_transformations(model_proto, model_path);
+                return convert_model(std::make_shared<ONNX_NAMESPACE::ModelProto>(model_proto));
+            }
+
+            std::shared_ptr<Function>
+                import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
+                                  const std::string& model_path)
+            {
+                apply_transformations(*model_proto, model_path);
+                return convert_model(std::move(model_proto));
+            }
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
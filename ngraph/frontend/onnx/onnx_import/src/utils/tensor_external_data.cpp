@@ -2,7 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <fstream>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -16,6 +26,196 @@ namespace ngraph
     {
         namespace detail
         {
+            namespace
+            {
+                /// \brief  Read-only view of a part of a file mapped into the process memory
+                ///
+                /// \note   The mapping is private, so writes through the buffer never reach
+                ///         the file.
+                class MappedFileBuffer : public runtime::AlignedBuffer
+                {
+                public:
+                    /// \brief  Maps `length` bytes of the file starting at `offset`.
+                    ///         Zero length stands for the rest of the file.
+                    ///
+                    /// \return The buffer or nullptr if the file can't be mapped or the
+                    ///         requested range exceeds the file.
+                    template <typename Path>
+                    static std::shared_ptr<runtime::AlignedBuffer>
+                        map(const Path& path, uint64_t offset, uint64_t length)
+                    {
+                        std::shared_ptr<MappedFileBuffer> buffer{new MappedFileBuffer};
+                        if (!buffer->map_file(path, offset, length))
+                            return nullptr;
+                        return buffer;
+                    }
+
+                    ~MappedFileBuffer() override
+                    {
+                        unmap();
+                        // the memory doesn't belong to the AlignedBuffer allocator
+                        m_allocated_buffer = nullptr;
+                        m_aligned_buffer = nullptr;
+                        m_byte_size = 0;
+                    }
+
+                private:
+                    MappedFileBuffer() = default;
+
+                    /// \brief  Checks the requested range against the file size and resolves
+                    ///         the zero length. The mapping itself starts at `offset` rounded
+                    ///         down to `granularity` as the systems require.
+                    bool set_range(uint64_t file_size,
+                                   uint64_t offset,
+                                   uint64_t length,
+                                   uint64_t granularity)
+                    {
+                        if (offset > file_size)
+                            return false;
+                        if (length == 0) // map the rest of the file
+                            length = file_size - offset;
+                        if (length > file_size - offset)
+                            return false;
+                        m_data_offset = static_cast<size_t>(offset % granularity);
+                        m_map_offset = offset - m_data_offset;
+                        m_map_size = static_cast<size_t>(m_data_offset + length);
+                        m_byte_size = static_cast<size_t>(length);
+                        return true;
+                    }
+
+#ifdef _WIN32
+                    template <typename Path>
+                    bool map_file(const Path& path, uint64_t offset, uint64_t length)
+                    {
+                        HANDLE file = open_file(path);
+                        if (file == INVALID_HANDLE_VALUE)
+                            return false;
+
+                        SYSTEM_INFO info;
+                        GetSystemInfo(&info);
+                        LARGE_INTEGER file_size;
+                        if (!GetFileSizeEx(file, &file_size) ||
+                            !set_range(static_cast<uint64_t>(file_size.QuadPart),
+                                       offset,
+                                       length,
+                                       info.dwAllocationGranularity))
+                        {
+                            CloseHandle(file);
+                            return false;
+                        }
+                        if (m_byte_size == 0)
+                        {
+                            CloseHandle(file);
+                            return true;
+                        }
+
+                        HANDLE mapping =
+                            CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                        // the mapping object holds its own reference to the file
+                        CloseHandle(file);
+                        if (mapping == nullptr)
+                            return false;
+
+                        m_mapping = MapViewOfFile(mapping,
+                                                  FILE_MAP_COPY,
+                                                  static_cast<DWORD>(m_map_offset >> 32),
+                                                  static_cast<DWORD>(m_map_offset & 0xFFFFFFFF),
+                                                  m_map_size);
+                        CloseHandle(mapping);
+                        if (m_mapping == nullptr)
+                            return false;
+
+                        set_data();
+                        return true;
+                    }
+
+                    static HANDLE open_file(const std::wstring& path)
+                    {
+                        return CreateFileW(path.c_str(),
+                                           GENERIC_READ,
+                                           FILE_SHARE_READ,
+                                           nullptr,
+                                           OPEN_EXISTING,
+                                           FILE_ATTRIBUTE_NORMAL,
+                                           nullptr);
+                    }
+
+                    static HANDLE open_file(const std::string& path)
+                    {
+                        return CreateFileA(path.c_str(),
+                                           GENERIC_READ,
+                                           FILE_SHARE_READ,
+                                           nullptr,
+                                           OPEN_EXISTING,
+                                           FILE_ATTRIBUTE_NORMAL,
+                                           nullptr);
+                    }
+
+                    void unmap()
+                    {
+                        if (m_mapping != nullptr)
+                            UnmapViewOfFile(m_mapping);
+                        m_mapping = nullptr;
+                    }
+#else
+                    bool map_file(const std::string& path, uint64_t offset, uint64_t length)
+                    {
+                        int fd = open(path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                            return false;
+
+                        struct stat sb = {};
+                        if (fstat(fd, &sb) == -1 ||
+                            !set_range(static_cast<uint64_t>(sb.st_size),
+                                       offset,
+                                       length,
+                                       static_cast<uint64_t>(sysconf(_SC_PAGESIZE))))
+                        {
+                            close(fd);
+                            return false;
+                        }
+                        if (m_byte_size == 0)
+                        {
+                            close(fd);
+                            return true;
+                        }
+
+                        void* mapping = mmap(nullptr,
+                                             m_map_size,
+                                             PROT_READ | PROT_WRITE,
+                                             MAP_PRIVATE,
+                                             fd,
+                                             static_cast<off_t>(m_map_offset));
+                        // the mapping holds its own reference to the file
+                        close(fd);
+                        if (mapping == MAP_FAILED)
+                            return false;
+
+                        m_mapping = mapping;
+                        set_data();
+                        return true;
+                    }
+
+                    void unmap()
+                    {
+                        if (m_mapping != nullptr)
+                            munmap(m_mapping, m_map_size);
+                        m_mapping = nullptr;
+                    }
+#endif
+
+                    void set_data()
+                    {
+                        m_aligned_buffer = static_cast<char*>(m_mapping) + m_data_offset;
+                    }
+
+                    void* m_mapping = nullptr;
+                    uint64_t m_map_offset = 0;
+                    size_t m_map_size = 0;
+                    size_t m_data_offset = 0;
+                };
+            } // namespace
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -23,53 +223,30 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_length = std::stoi(entry.value());
+                        m_data_length = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            std::shared_ptr<runtime::AlignedBuffer> TensorExternalData::load_external_data() const
             {
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
 #else
                 std::string path = m_data_location;
 #endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
-                    throw error::invalid_external_data{*this};
-
-                std::streamsize read_data_length;
-                if (m_data_length == 0) // read entire file
-                    read_data_length = external_data_stream.tellg();
-                else
-                    read_data_length = m_data_length;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
-
                 if (m_sha1_digest != 0)
                 {
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_length);
-                external_data_stream.read(&read_data[0], read_data_length);
-                external_data_stream.close();
-
-                return read_data;
+                auto data = MappedFileBuffer::map(path, m_offset, m_data_length);
+                if (data == nullptr)
+                    throw error::invalid_external_data{*this};
+                return data;
             }
 
             std::string TensorExternalData::to_string() const
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -20,12 +23,15 @@ namespace ngraph
 
                 /// \brief      Load external data from tensor passed to constructor
                 ///
-                /// \note       If read data from external file fails,
+                /// \note       The data is not read into memory but the requested part of
+                ///             the external file is mapped (copy-on-write), so the returned
+                ///             buffer can back a Constant directly. The mapping is released
+                ///             together with the last reference to the buffer.
                 /// \note       If reading data from external files fails,
                 ///             the invalid_external_data exception is thrown.
                 ///
-                /// \return     External binary data loaded into a std::string
-                std::string load_external_data() const;
+                /// \return     Buffer holding the external binary data
+                std::shared_ptr<runtime::AlignedBuffer> load_external_data() const;
 
                 /// \brief      Represets parameter of external data as string
                 ///
@@ -34,8 +40,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_length = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_length = 0;
                 int m_sha1_digest = 0;
             };
         } // namespace detail
@@ -559,4 +559,74 @@ TEST(build_graph, build_graph_unregistred_variables)
 
     EXPECT_ANY_THROW(make_shared<Function>(OutputVector{res, res2}, SinkVector{assign, assign_2},
                                    ParameterVector{arg, arg2}, VariableVector{variable}));
-}
\ No newline at end of file
+}
+
+TEST(build_graph, topological_cache_replace_node)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto sigmoid = make_shared<Sigmoid>(relu);
+    auto res = make_shared<Result>(sigmoid);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops, (NodeVector{arg, relu, sigmoid, res}));
+    EXPECT_EQ(f->get_ordered_ops(), ordered_ops);
+
+    auto tanh = make_shared<Tanh>(arg);
+    replace_node(relu, tanh);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, tanh, sigmoid, res}));
+
+    // rewiring of a single input
+    auto abs = make_shared<Abs>(tanh);
+    sigmoid->input(0).replace_source_output(abs);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, tanh, abs, sigmoid, res}));
+}
+
+TEST(build_graph, topological_cache_roots_and_control_dependencies)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto arg2 = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto sigmoid = make_shared<Sigmoid>(arg2);
+    auto res2 = make_shared<Result>(sigmoid);
+    f->add_parameters({arg2});
+    f->add_results({res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 6);
+
+    // sigmoid is forced to run before relu
+    relu->add_control_dependency(sigmoid);
+    auto ordered_ops = f->get_ordered_ops();
+    auto position = [&](const shared_ptr<Node>& node) {
+        return find(ordered_ops.begin(), ordered_ops.end(), node) - ordered_ops.begin();
+    };
+    EXPECT_LT(position(sigmoid), position(relu));
+
+    f->remove_result(res2);
+    f->remove_parameter(arg2);
+    relu->clear_control_dependencies();
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, res}));
+}
+
+TEST(build_graph, topological_cache_shared_nodes)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    auto f2 = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 3);
+
+    // a change of the common nodes invalidates the caches of both functions
+    replace_node(relu, make_shared<Sigmoid>(make_shared<Abs>(arg)));
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 4);
+}
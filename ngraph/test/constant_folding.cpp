@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -3430,3 +3432,118 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, large_dequantization_chains)
+{
+    // large enough for the elementwise folds to be split between threads
+    const Shape shape{4, 256, 1024};
+    const size_t size = shape_size(shape);
+    vector<int8_t> weights(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        weights[i] = static_cast<int8_t>(static_cast<int>(i % 255) - 127);
+    }
+
+    ResultVector results;
+    for (size_t branch = 0; branch < 3; ++branch)
+    {
+        auto data = op::Constant::create(element::i8, shape, weights);
+        auto convert = make_shared<opset5::Convert>(data, element::f32);
+        auto zero_point = op::Constant::create(element::f32, Shape{1}, {1.0f});
+        auto subtract = make_shared<opset5::Subtract>(convert, zero_point);
+        auto scale = op::Constant::create(element::f32, Shape{}, {0.5f * (branch + 1)});
+        auto multiply = make_shared<opset5::Multiply>(subtract, scale);
+        auto relu = make_shared<opset5::Relu>(multiply);
+        results.push_back(make_shared<opset5::Result>(relu));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 3);
+    for (size_t branch = 0; branch < 3; ++branch)
+    {
+        auto values = get_result_constant<float>(f, branch);
+        ASSERT_EQ(values.size(), size);
+        vector<float> expected(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            expected[i] = max(0.0f, (weights[i] - 1.0f) * 0.5f * (branch + 1));
+        }
+        range_test_check(values, expected);
+    }
+}
+
+TEST(constant_folding, shared_constant_consumers)
+{
+    const Shape shape{256, 512};
+    auto data =
+        op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 2.0f));
+    ResultVector results;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        auto like = op::Constant::create(i % 2 ? element::i32 : element::f16, Shape{}, {0});
+        auto convert_like = make_shared<opset5::ConvertLike>(data, like);
+        auto reshape = make_shared<opset5::Reshape>(
+            convert_like, op::Constant::create(element::i64, Shape{1}, {-1}), false);
+        results.push_back(make_shared<opset5::Result>(reshape));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::ConvertLike>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Reshape>(f), 0);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        auto values = get_result_constant<float>(f, i);
+        ASSERT_EQ(values, vector<float>(shape_size(shape), 2.0f));
+    }
+}
+
+TEST(constant_folding, concurrent_passes_with_thread_limit)
+{
+    const Shape shape{2, 512, 1024};
+    auto make_function = [&](float scale) {
+        auto data = op::Constant::create(
+            element::i8, shape, vector<int8_t>(shape_size(shape), static_cast<int8_t>(3)));
+        auto convert = make_shared<opset5::Convert>(data, element::f32);
+        auto multiply = make_shared<opset5::Multiply>(
+            convert, op::Constant::create(element::f32, Shape{}, {scale}));
+        return make_shared<Function>(ResultVector{make_shared<opset5::Result>(multiply)},
+                                     ParameterVector{});
+    };
+
+    vector<shared_ptr<Function>> functions;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        functions.push_back(make_function(static_cast<float>(i + 1)));
+    }
+    vector<thread> threads;
+    for (const auto& f : functions)
+    {
+        threads.emplace_back([f]() {
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::ConstantFolding>(2);
+            pass_manager.run_passes(f);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < functions.size(); ++i)
+    {
+        ASSERT_EQ(count_ops_of_type<opset5::Multiply>(functions[i]), 0);
+        auto values = get_result_constant<float>(functions[i], 0);
+        range_test_check(values, vector<float>(shape_size(shape), 3.0f * (i + 1)));
+    }
+}
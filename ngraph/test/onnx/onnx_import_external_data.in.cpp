@@ -89,6 +89,40 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_unaligned_offset)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_unaligned_offset.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {2, 1} read from a part of the page, second: {2, 3} read till the end of file
+    test_case.add_input<int32_t>({1, 5});
+
+    test_case.add_expected_output<int32_t>({2, 5});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_out_of_range_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_out_of_range.prototxt"));
+        FAIL() << "External data exceeding the file size not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(
+            testing::IsSubstring,
+            std::string("multiple_tensors.data, offset: 4100, data_length: 12, sha1_digest: 0)"),
+            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <iostream>
+#include <string>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Builds a synthetic network of `blocks` residual blocks,
+ * every block adds 10 operations, so 1000 blocks give a graph of ~10k nodes
+ */
+std::shared_ptr<ngraph::Function> makeLargeGraph(size_t blocks) {
+  using namespace ngraph;
+  const size_t channels = 64;
+  auto param = std::make_shared<opset1::Parameter>(element::f32, Shape{1, channels});
+  Output<Node> last = param;
+  for (size_t i = 0; i < blocks; i++) {
+    auto weights = opset1::Constant::create(element::f32, Shape{channels, channels},
+                                            std::vector<float>(channels * channels, 0.01f));
+    auto matmul = std::make_shared<opset1::MatMul>(last, weights, false, true);
+    auto bias = opset1::Constant::create(element::f32, Shape{1, channels}, std::vector<float>(channels, 0.1f));
+    auto add = std::make_shared<opset1::Add>(matmul, bias);
+    auto relu = std::make_shared<opset1::Relu>(add);
+    auto scale = opset1::Constant::create(element::f32, Shape{1, channels}, std::vector<float>(channels, 0.5f));
+    auto multiply = std::make_shared<opset1::Multiply>(relu, scale);
+    auto shift = opset1::Constant::create(element::f32, Shape{1, channels}, std::vector<float>(channels, 0.f));
+    auto subtract = std::make_shared<opset1::Subtract>(multiply, shift);
+    last = std::make_shared<opset1::Add>(subtract, last);
+  }
+  auto result = std::make_shared<opset1::Result>(last);
+  return std::make_shared<Function>(ResultVector{result}, ParameterVector{param}, "large_graph");
+}
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The network is generated, so the model argument is the number of the
+ * generated blocks instead of a path (e.g. `-m 1000` for ~10k nodes).
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+
+    {
+      SCOPED_TIMER(load_plugin);
+      ie.GetVersions(device);
+    }
+    {
+      SCOPED_TIMER(create_function);
+      cnnNetwork = CNNNetwork(makeLargeGraph(std::stoul(model)));
+    }
+    {
+      // dominated by the common and the plugin specific graph transformations
+      SCOPED_TIMER(load_network);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}